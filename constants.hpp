@@ -1,5 +1,6 @@
 #pragma once
 #include <cstdint>
+#include <array>
 
 
 namespace largeNumberLibrary {
@@ -10,4 +11,50 @@ namespace largeNumberLibrary {
 	constexpr uint64_t UINT63_MAX = 0x7FFFFFFFFFFFFFFF;
 	// equivalent to INT64_MIN
 	constexpr uint64_t BIT64_ON = 0x8000000000000000;
+
+	// Digit characters for number bases up to 36
+	constexpr char DIGIT_CHARS[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+	// Value of every character as a digit (255 for characters which aren't digits in any base up to 36)
+	// Both upper and lower case letters are accepted
+	constexpr std::array<uint8_t, 256> DIGIT_VALUES = [] {
+		std::array<uint8_t, 256> values = {};
+		values.fill(255);
+		for (int i = 0; i < 10; i++) values['0' + i] = i;
+		for (int i = 0; i < 26; i++) {
+			values['A' + i] = 10 + i;
+			values['a' + i] = 10 + i;
+		}
+		return values;
+	}();
+	// Every pair of decimal digits from "00" to "99", used to print two decimal digits at once
+	constexpr char DECIMAL_DIGIT_PAIRS[] =
+		"0001020304050607080910111213141516171819"
+		"2021222324252627282930313233343536373839"
+		"4041424344454647484950515253545556575859"
+		"6061626364656667686970717273747576777879"
+		"8081828384858687888990919293949596979899";
+
+	// The digits of a chunk which is zero, in any base up to 36 (a word holds at most 20 digits of a base that isn't a power of two)
+	constexpr char ZERO_CHUNK[] = "00000000000000000000";
+
+	// Secrets and mixing function of wyhash (https://github.com/wangyi-fudan/wyhash)
+	// Used by the std::hash specializations of int128 and int_limited
+	constexpr uint64_t HASH_SECRET_0 = 0xa0761d6478bd642f;
+	constexpr uint64_t HASH_SECRET_1 = 0xe7037ed1a0b428db;
+
+	// Multiplies the values into 128 bits and folds the halves together
+	constexpr uint64_t hashMix(uint64_t A, uint64_t B) {
+		#if defined(__SIZEOF_INT128__)
+		unsigned __int128 product = (unsigned __int128)A * B;
+		return uint64_t(product) ^ uint64_t(product >> 64);
+		#else
+		uint64_t lowA = A & UINT32_MAX, highA = A >> 32;
+		uint64_t lowB = B & UINT32_MAX, highB = B >> 32;
+		uint64_t low = lowA * lowB, mid1 = highA * lowB, mid2 = lowA * highB, high = highA * highB;
+		uint64_t mid = (low >> 32) + (mid1 & UINT32_MAX) + (mid2 & UINT32_MAX);
+		high += (mid1 >> 32) + (mid2 >> 32) + (mid >> 32);
+		low = (low & UINT32_MAX) | (mid << 32);
+		return low ^ high;
+		#endif
+	}
 }
\ No newline at end of file
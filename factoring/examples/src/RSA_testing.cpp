@@ -4,6 +4,7 @@
 #include <chrono>
 #include <iostream>
 using largeNumberLibrary::int_limited;
+using largeNumberLibrary::uint_limited;
 
 std::vector<int> RSA_bits = {60, 70, 80, 100, 120, 140, 160, 180};
 
@@ -60,22 +61,22 @@ std::vector<std::vector<int_limited<256>>> test_values {
 
 int main() {
 	bool QS_debug = false, sieve_debug = false;
-	Factoriser::QuadraticSieve<256> QS(QS_debug, sieve_debug);
+	Factoriser::QuadraticSieve<uint_limited<256>> QS(QS_debug, sieve_debug);
 	Factoriser::Basic::prepare_primes();
 
 	for (int i = 0; i < test_values.size(); i++) {
 		double times = 0;
 		std::cout << "Testing " << RSA_bits[i] << " bit values" << std::endl;
 		for (int j = 0; j < test_values[i].size(); j++) {
-			int_limited<256> value = test_values[i][j];
+			uint_limited<256> value = test_values[i][j];
 			auto start = std::chrono::steady_clock::now();
-			std::vector<int_limited<256>> factors = QS.factorise(value);
+			std::vector<uint_limited<256>> factors = QS.factorise(value);
 			auto end = std::chrono::steady_clock::now();
 	
 			assert(factors.size() == 2);
 			if (QS_debug) std::cout << "Factors: ";
-			int_limited<256> test = 1;
-			for (int_limited<256> factor : factors) {
+			uint_limited<256> test = 1;
+			for (uint_limited<256> factor : factors) {
 				assert(Factoriser::Basic::is_prime(factor));
 				if (QS_debug) std::cout << factor << " ";
 				test *= factor;
@@ -6,8 +6,9 @@
 
 int main() {
 	using largeNumberLibrary::int_limited;
+	using largeNumberLibrary::uint_limited;
 	bool QS_debug = true, sieve_debug = false;
-	Factoriser::QuadraticSieve<256> QS(QS_debug, sieve_debug);
+	Factoriser::QuadraticSieve<uint_limited<256>> QS(QS_debug, sieve_debug);
 	int_limited<256> a, b;
 	int test_iterations;
 	b = 0xde;
@@ -24,12 +25,12 @@ int main() {
 
 	for (int i = 0; i < test_iterations; i++) {
 		auto start = std::chrono::steady_clock::now();
-		std::vector<int_limited<256>> factors = QS.factorise(a);
+		std::vector<uint_limited<256>> factors = QS.factorise(uint_limited<256>(a));
 		auto end = std::chrono::steady_clock::now();
 
 		std::cout << "Factors: ";
 		int_limited<256> test = 1;
-		for (int_limited<256> factor : factors) {
+		for (uint_limited<256> factor : factors) {
 			assert(Factoriser::Basic::is_prime(factor));
 			std::cout << factor << " ";
 			test *= factor;
@@ -0,0 +1,53 @@
+#include "../../../int128.hpp"
+#include "../../../int_limited.hpp"
+#include "../../factoriser.hpp"
+#include "../../factoriser_basic.hpp"
+#include "../../factoriser_boost.hpp"
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+using largeNumberLibrary::int128;
+using largeNumberLibrary::uint128;
+using largeNumberLibrary::uint_limited;
+using boost::multiprecision::cpp_int;
+
+std::vector<std::string> test_values {
+	"3735928559", // 32 bit
+	"633786492115673591", // 60 bit
+	"116575300957664735452709", // 77 bit
+	"177759468966084069834499", // 80 bit
+	"115702745353349312768573158633", // 100 bit
+};
+
+// Factorises every test value with the integer type T and prints the time it took
+template<typename T>
+void benchmark(std::string const& name) {
+	std::cout << name << ": ";
+	double total = 0;
+	for (std::string const& str : test_values) {
+		T value(str.c_str());
+		auto start = std::chrono::steady_clock::now();
+		std::vector<T> factors = Factoriser::factorise(value);
+		auto end = std::chrono::steady_clock::now();
+
+		T test = 1;
+		for (T const& factor : factors) test *= factor;
+		assert(value == test);
+		double elapsed = std::chrono::duration<double>(end - start).count();
+		std::cout << elapsed << "s | ";
+		total += elapsed;
+	}
+	std::cout << "total " << total << "s" << std::endl;
+}
+
+// Compares the integer types, which can be used by the factoriser
+int main() {
+	Factoriser::Basic::prepare_primes();
+
+	benchmark<int128>("int128");
+	benchmark<uint128>("uint128");
+	benchmark<uint_limited<128>>("uint_limited<128>");
+	benchmark<uint_limited<256>>("uint_limited<256>");
+	benchmark<cpp_int>("boost::multiprecision::cpp_int");
+}
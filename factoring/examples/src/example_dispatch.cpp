@@ -0,0 +1,79 @@
+#include "../../../int_limited.hpp"
+#include "../../factoriser.hpp"
+#include <cassert>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+using largeNumberLibrary::uint_limited;
+using Factoriser::dispatch_int;
+
+// Multiplies small odd primes (below 1000) into a value until it has at least the given amount of bits
+dispatch_int small_prime_product(int bits) {
+	dispatch_int value = 1;
+	for (uint64_t prime = 3; value.ilog2() < bits; prime += 2) {
+		if (Factoriser::Basic::is_small_prime(prime, 1000)) value *= prime;
+		if (prime > 1000) prime = 1;
+	}
+	return value;
+}
+
+// Factorises the value through the runtime dispatch (as a string and as bytes),
+// checks that the factors are sorted primes whose product is the value,
+// and that the factorisation moved through all the given stages (as printed by the debug output)
+void test_dispatch(dispatch_int const& value, std::vector<std::string> const& stages) {
+	std::cout << value.ilog2() << " bit value: ";
+	std::stringstream debug_output;
+	std::streambuf* cout_buffer = std::cout.rdbuf(debug_output.rdbuf());
+	Factoriser::debug = true;
+	std::vector<std::string> factors = Factoriser::factorise(value.toString());
+	Factoriser::debug = false;
+	std::cout.rdbuf(cout_buffer);
+
+	dispatch_int product = 1;
+	dispatch_int previous = 1;
+	for (std::string const& str : factors) {
+		dispatch_int factor(str.c_str());
+		assert(factor >= previous);
+		assert(Factoriser::Basic::is_prime(factor));
+		product *= factor;
+		previous = factor;
+	}
+	assert(product == value);
+	for (std::string const& stage : stages) assert(debug_output.str().find(stage) != std::string::npos);
+
+	std::vector<uint8_t> bytes(128);
+	value.exportBytes(bytes, std::endian::little);
+	std::vector<std::vector<uint8_t>> byte_factors = Factoriser::factorise(bytes, std::endian::little);
+	assert(byte_factors.size() == factors.size());
+	for (size_t i = 0; i < factors.size(); i++) {
+		dispatch_int factor;
+		factor.importBytes(byte_factors[i], std::endian::little);
+		assert(factor.toString() == factors[i]);
+	}
+	std::cout << factors.size() << " factors" << std::endl;
+}
+
+int main() {
+	Factoriser::Basic::prepare_primes();
+
+	// Stage 1 divides out the small primes with the 1024 bit type, after which the rest (1009 * 35184372088891)
+	// fits into uint128 and into uint64_t, so stage 2 divides it natively
+	test_dispatch(small_prime_product(950) * 1009 * uint64_t(35184372088891), {"Stage 1: trial division up to 1000 & primality test (1024 bit type)", "(128 bit type)"});
+	// The same, but the rest (34359738421 * 68719476767) has to be split by the quadratic sieve with uint128
+	test_dispatch(small_prime_product(900) * uint64_t(34359738421) * uint64_t(68719476767), {"(1024 bit type)", "Stage 3: Quadratic sieve until a factor is found (128 bit type)"});
+	// A value which fits into uint_limited<512> narrows down immediately
+	test_dispatch(small_prime_product(400) * 1009 * uint64_t(35184372088891), {"(512 bit type)", "(128 bit type)"});
+
+	// Values outside of the range of the dispatch
+	bool thrown = false;
+	try { Factoriser::factorise("0"); } catch (std::domain_error const&) { thrown = true; }
+	assert(thrown);
+	thrown = false;
+	try { Factoriser::factorise((dispatch_int(1) << 1022).toString()); } catch (std::overflow_error const&) { thrown = true; }
+	assert(thrown);
+
+	std::cout << "All dispatch tests passed" << std::endl;
+	return 0;
+}
@@ -3,9 +3,8 @@
 #include "../../factoriser_basic.hpp"
 #include <chrono>
 #include <iostream>
-using largeNumberLibrary::int_limited;
-constexpr int bit_size = 256;
-typedef int_limited<bit_size> big_int;
+// The value can have any size up to 1022 bits, the factoriser chooses the integer type for it
+typedef Factoriser::dispatch_int big_int;
 
 bool str_is_num(std::string& str) {
 	for (char c : str) {
@@ -17,12 +16,13 @@ bool str_is_num(std::string& str) {
 void print_help() {
 	std::cout << "-h (--help)\tDisplays this help message" << std::endl;
 	std::cout << "-v [num] (--verbose)\tSets the verbosity of debug logs. Accepts values from 0(default) to 9, however the current highest setting is 3" << std::endl;
+	std::cout << "[value]\tThe value to factorise, either in base 10 or with a 0x (hexadecimal), 0o (octal) or 0b (binary) prefix" << std::endl;
 }
 
 int main(int argc, const char* argv[]) {
 
 	int verbosity = 0;
-	big_int value = 0;
+	std::string value = "0";
 
 	// load all arguments from command line
 	for (int i = 1; i < argc; i++) {
@@ -38,10 +38,8 @@ int main(int argc, const char* argv[]) {
 			print_help();
 			return 0;
 		} else {
-			// accept value from input
-			if (!str_is_num(arg)) throw std::logic_error("Error: invalid value for factorisation");
-			std::string max_val = big_int::MAX_VALUE().toString();
-			if (arg.size() >= max_val.size() && arg > max_val) throw std::overflow_error("Error: Value is larger than a signed " + std::to_string(bit_size) + " integer");
+			// accept value from input (in base 10, or in base 16, 8 or 2 with a "0x", "0o" or "0b" prefix)
+			// it is validated by factorise()
 			value = arg;
 		}
 	}
@@ -52,17 +50,20 @@ int main(int argc, const char* argv[]) {
 	Factoriser::Basic::prepare_primes();
 	
 	auto start = std::chrono::steady_clock::now();
-	std::vector<big_int> factors = Factoriser::factorise(value);
+	std::vector<std::string> factors = Factoriser::factorise(value);
 	auto end = std::chrono::steady_clock::now();
 
 	std::cout << "Factors: ";
 	big_int test = 1;
-	for (big_int factor : factors) {
-		assert(Factoriser::Basic::is_prime(factor));
+	for (std::string const& factor : factors) {
+		big_int big_factor(factor.c_str());
+		assert(Factoriser::Basic::is_prime(big_factor));
 		std::cout << factor << " ";
-		test *= factor;
+		test *= big_factor;
 	}
-	assert(value == test);
+	big_int big_value;
+	from_chars(value.data(), value.data() + value.size(), big_value, 0);
+	assert(big_value == test);
 	if (verbosity > 0) std::cout << "\nFactorisation took " << std::chrono::duration<double>(end - start).count() << " seconds" << std::endl;
 	if (verbosity > 1) std::cout << "Factors were asserted to be prime and their product was correct" << std::endl;
 }
\ No newline at end of file
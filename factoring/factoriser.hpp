@@ -1,35 +1,35 @@
 #pragma once
 #include <cstdint>
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include "factoriser_math.hpp"
 #include "factoriser_basic.hpp"
 #include "factoriser_QS.hpp"
-#include "../int_limited.hpp"
+#include "factoriser_integer.hpp"
 
 namespace Factoriser {
-	using largeNumberLibrary::int_limited;
-
 	bool debug = false;
 	bool QS_debug = false;
 	bool sieve_debug = false;
 
-	// Simple bubble sort, suitable for ascending subsequences
-	template<int bit_size>
-	void sort_factors(std::vector<int_limited<bit_size>>& factors) {
-		for (int i = 1; i < factors.size(); i++) {
-			if (factors[i] > factors[i-1]) continue;
-			for (int j = i; j > 0; j--) {
-				if (factors[j] > factors[j-1]) break;
-				int_limited<bit_size> temp = factors[j];
-				factors[j] = factors[j-1];
-				factors[j-1] = temp;
-			}
-		}
+	// Sorts the factors in ascending order
+	template<integer_backend T>
+	void sort_factors(std::vector<T>& factors) {
+		std::sort(factors.begin(), factors.end());
 	}
 
-	template<int bit_size>
-	std::vector<int_limited<bit_size>> factorise(int_limited<bit_size> value) {
-		typedef int_limited<bit_size> qs_int;
-		if (debug) std::cout << "=============== Factoriser input: " << value << " (" << value.ilog2() << " bits) ===============" << std::endl;
+	// Works with any integer_backend (e.g. uint_limited, int128 or boost::multiprecision::cpp_int with factoriser_boost.hpp)
+	// The value has to be positive and the type needs at least 96 bits, since the quadratic sieve raises small values above 80 bits (see calc_kN())
+	template<integer_backend T>
+	std::vector<T> factorise(T value) {
+		typedef T qs_int;
+		if (debug) std::cout << "=============== Factoriser input: " << value << " (" << Math::ilog2(value) << " bits) ===============" << std::endl;
 		if (Basic::is_prime(value)) return {value};
 		
 		std::vector<qs_int> factors;
@@ -64,7 +64,7 @@ namespace Factoriser {
 
 		if (debug) std::cout << "Stage 3: Quadratic sieve until the value is a strong probable prime to 25 bases" << std::endl;
 		{
-			QuadraticSieve<bit_size> QS(QS_debug, sieve_debug);
+			QuadraticSieve<T> QS(QS_debug, sieve_debug);
 			
 			do {
 				if (QS_debug) std::cout << std::endl;
@@ -82,4 +82,129 @@ namespace Factoriser {
 		sort_factors(factors);
 		return factors;
 	};
+
+	// The factorisation itself is done with unsigned values, which skips all sign handling
+	// Converting between int_limited and uint_limited of the same size only copies the words
+	template<int bit_size>
+	std::vector<int_limited<bit_size>> factorise(int_limited<bit_size> const& value) {
+		std::vector<int_limited<bit_size>> factors;
+		for (uint_limited<bit_size> const& factor : factorise(uint_limited<bit_size>(value))) factors.push_back(factor);
+		return factors;
+	}
+
+	// The widest integer type used by the runtime dispatch of factorise() (for strings and bytes)
+	typedef uint_limited<1024> dispatch_int;
+
+	// Helpers of the runtime dispatch, which aren't meant to be used directly
+	namespace detail {
+		// The integer type used by the runtime dispatch for a bit size (128, 256, 512 or 1024)
+		template<int bit_size>
+		using width_int = std::conditional_t<bit_size == 128, uint128, uint_limited<bit_size>>;
+
+		// The quadratic sieve squares the rounded up square root of the value,
+		// which needs one more bit than the value itself, so two bits are left free
+		constexpr int max_value_bits(int bit_size) {
+			return bit_size - 2;
+		}
+
+		// Adds the prime factors of value to factors, continuing from the given stage of factorise()
+		// (trial_bound is the upper bound of trial division which was already done)
+		// Whenever the rest of the value fits into a narrower type, it is converted and factorised with it instead
+		template<int bit_size>
+		void factorise_with_width(width_int<bit_size> value, std::vector<dispatch_int>& factors, uint64_t trial_bound = 0) {
+			typedef width_int<bit_size> qs_int;
+			if (value == 1) return;
+			if constexpr (bit_size > 128) {
+				if (Math::ilog2(value) <= max_value_bits(bit_size/2)) {
+					factorise_with_width<bit_size/2>(width_int<bit_size/2>(value), factors, trial_bound);
+					return;
+				}
+			}
+			if (Basic::is_prime(value)) {
+				factors.push_back(value);
+				return;
+			}
+
+			if (trial_bound < 100000) {
+				uint64_t bound = trial_bound < 1000 ? 1000 : 100000;
+				if (debug) std::cout << "Stage " << (bound == 1000 ? 1 : 2) << ": trial division up to " << bound << " & primality test (" << bit_size << " bit type)" << std::endl;
+				// Values which fit into 64 bits are divided natively
+				std::vector<uint64_t> small_factors;
+				if (Math::ilog2(value) <= 64) small_factors = Basic::trial_division(uint64_t(value), bound);
+				else small_factors = Basic::trial_division(value, bound);
+				for (uint64_t prime : small_factors) {
+					value /= prime;
+					factors.push_back(prime);
+				}
+				factorise_with_width<bit_size>(value, factors, bound);
+				return;
+			}
+
+			if (debug) std::cout << "Stage 3: Quadratic sieve until a factor is found (" << bit_size << " bit type)" << std::endl;
+			// The same instance is kept until a factor is found, since it moves the sieve when attempting the same value again
+			QuadraticSieve<qs_int> QS(QS_debug, sieve_debug);
+			qs_int previous = value;
+			do {
+				if (QS_debug) std::cout << std::endl;
+				for (qs_int const& prime : QS.factorise(value)) {
+					value /= prime;
+					factors.push_back(prime);
+				}
+			} while (value == previous);
+			if (QS_debug) std::cout << std::endl;
+			factorise_with_width<bit_size>(value, factors, trial_bound);
+		}
+
+		// Throws if the value can't be factorised by the runtime dispatch
+		inline void check_dispatch_value(dispatch_int const& value) {
+			if (value == 0) throw std::domain_error("Error: Unable to factorise zero");
+			if (value.ilog2() > max_value_bits(1024)) throw std::overflow_error("Error: Value is larger than " + std::to_string(max_value_bits(1024)) + " bits");
+		}
+
+		// Factorises the value with the smallest integer type it fits into
+		inline std::vector<dispatch_int> factorise_dispatch(dispatch_int const& value) {
+			check_dispatch_value(value);
+			if (debug) std::cout << "=============== Factoriser input: " << value << " (" << value.ilog2() << " bits) ===============" << std::endl;
+			std::vector<dispatch_int> factors;
+			factorise_with_width<1024>(value, factors);
+			sort_factors(factors);
+			return factors;
+		}
+	}
+
+	// Factorises a value of any size up to 1022 bits, given in base 10 (or in base 16, 8 or 2 with a "0x", "0o" or "0b" prefix)
+	// The value is factorised with the smallest of uint128 and uint_limited<256>, <512> or <1024> which it fits into,
+	// moving to narrower types as factors are divided out (and to uint64_t for trial division)
+	// The factors are returned in base 10, in ascending order
+	// Throws std::domain_error for an invalid value (or zero) and std::overflow_error if it is too large
+	inline std::vector<std::string> factorise(std::string_view value) {
+		dispatch_int number;
+		std::from_chars_result result = from_chars(value.data(), value.data() + value.size(), number, 0);
+		if (result.ec == std::errc::result_out_of_range) throw std::overflow_error("Error: Value is larger than " + std::to_string(detail::max_value_bits(1024)) + " bits");
+		if (result.ec != std::errc() || result.ptr != value.data() + value.size()) throw std::domain_error("Error: Invalid value for factorisation");
+
+		std::vector<std::string> factors;
+		for (dispatch_int const& factor : detail::factorise_dispatch(number)) factors.push_back(factor.toString());
+		return factors;
+	}
+
+	// The same as above, but the value is an unsigned value in the given byte order (of any length)
+	// Each factor is returned with the least amount of bytes, in the same byte order
+	inline std::vector<std::vector<uint8_t>> factorise(std::span<const uint8_t> bytes, std::endian order = std::endian::big) {
+		// Leading zero bytes don't change the value, so they are skipped before checking the size
+		while (!bytes.empty() && (order == std::endian::big ? bytes.front() : bytes.back()) == 0) {
+			bytes = order == std::endian::big ? bytes.subspan(1) : bytes.first(bytes.size() - 1);
+		}
+		if (bytes.size() > 1024/8) throw std::overflow_error("Error: Value is larger than " + std::to_string(detail::max_value_bits(1024)) + " bits");
+		dispatch_int number;
+		number.importBytes(bytes, order);
+
+		std::vector<std::vector<uint8_t>> factors;
+		for (dispatch_int const& factor : detail::factorise_dispatch(number)) {
+			std::vector<uint8_t> factor_bytes((factor.ilog2() + 7) / 8);
+			factor.exportBytes(factor_bytes, order);
+			factors.push_back(factor_bytes);
+		}
+		return factors;
+	}
 }
\ No newline at end of file
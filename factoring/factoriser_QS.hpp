@@ -3,17 +3,20 @@
 #include <cassert>
 #include <cmath>
 #include <cstdint>
+#include <span>
+#include <unordered_set>
 #include "factoriser_basic.hpp"
 #include "factoriser_math.hpp"
-#include "../int_limited.hpp"
+#include "factoriser_integer.hpp"
 
-// Since I decided to have the int_limited bit_size be a template,
+// Since the integer type is a template,
 // all of this has to live in a header file
 namespace Factoriser {
-	template<int bit_size>
+	// All values in the quadratic sieve are non-negative, so an unsigned type (e.g. uint_limited)
+	// skips the sign handling in every comparison, division and modulo
+	template<integer_backend T>
 	class QuadraticSieve {
-		typedef largeNumberLibrary::int_limited<bit_size> qs_int;
-		typedef largeNumberLibrary::int_limited<2*bit_size> qs_int_double;
+		typedef T qs_int;
 		typedef uint64_t ui64;
 	
 		class CustomBitset {
@@ -107,7 +110,7 @@ namespace Factoriser {
 			QS_poly(qs_int const& kN) {
 				// (sqrt(kN) + x)^2 - kN = x^2 + 2*sqrt(kN) + sqrt(kN)^2 - kN;
 				A = 1;
-				qs_int sqrt_kN = kN.isqrt()+1;
+				qs_int sqrt_kN = Math::isqrt(kN)+1;
 				B = sqrt_kN << 1;
 				C = sqrt_kN*sqrt_kN - kN;
 			}
@@ -170,8 +173,8 @@ namespace Factoriser {
 		qs_int calc_kN(qs_int const& N) const {
 			qs_int kN = N;
 			// Increase kN for small values, so that the sieving interval and factor base size is decent
-			if (kN.ilog2() < 80) kN *= (qs_int(1) << (80 - kN.ilog2())) + 17;
-			if (debug) std::cout << "N = " << N << " (" << N.ilog2() << " bits) | kN = " << kN << " (" << kN.ilog2() << " bits)" << std::endl;
+			if (Math::ilog2(kN) < 80) kN *= (qs_int(1) << (80 - Math::ilog2(kN))) + 17;
+			if (debug) std::cout << "N = " << N << " (" << Math::ilog2(N) << " bits) | kN = " << kN << " (" << Math::ilog2(kN) << " bits)" << std::endl;
 			return kN;
 		}
 	
@@ -179,7 +182,7 @@ namespace Factoriser {
 			// A rough heuristic based on the algorithm's complexity
 			// exp((0.5 + o(1))*(ln(N)ln(ln(N))^(0.5)))
 			ui64 B = std::ceil(std::exp(0.51*std::sqrt(
-								(2*kN.ilog2()/3) * std::log(kN.ilog2())
+								(2*Math::ilog2(kN)/3) * std::log(Math::ilog2(kN))
 							)
 						));
 			if (debug) std::cout << "B = " << B << " | ";
@@ -216,7 +219,7 @@ namespace Factoriser {
 				std::cout << "Polynomials used: ";
 				for (uint32_t i = 0; i < polynomials.size(); i++) {
 					// special log for single polynomial QS
-					std::cout << "(" << (polynomials[i].C + globals.kN).isqrt() << " + x)^2 - " << globals.kN << " | ";
+					std::cout << "(" << Math::isqrt(qs_int(polynomials[i].C + globals.kN)) << " + x)^2 - " << globals.kN << " | ";
 					// std::cout << polynomials[i].A << "x^2 + " << polynomials[i].B << "x + " << polynomials[i].C << " | ";
 				}
 				std::cout << std::endl;
@@ -234,7 +237,7 @@ namespace Factoriser {
 			// NOTE:
 			// Only calculating the log_threshold for a few values is *significantly* faster
 			// compared to calculating it for each poly(x) individually (though it is also less accurate)
-			ui64 base = poly(globals.sieve_start + interval/10).ilog2();
+			ui64 base = Math::ilog2(poly(globals.sieve_start + interval/10));
 			// We want a very low threshold, because verifying bad candidates is much slower than another sieve
 			// Experimentally, + (base >> 3) means having 1-2x less correct verifications, but up to 4-10x less candidates per sieve
 			ui64 threshold = (base >> 1) + (base >> 2) + (base >> 3);// - Math::count_bits(globals.factor_base.back());
@@ -249,7 +252,7 @@ namespace Factoriser {
 			// Solve it specially for the values (K + x)^2 = (sqrt(kN) + x)^x
 			// Since we know this is the single polynomial version
 			// And we won't have to convert Ax^2 + Bx + C into (K + L*x)^2 + M
-			qs_int K = globals.kN.isqrt()+1;
+			qs_int K = Math::isqrt(globals.kN)+1;
 			for (int i = 0; i < fb_size; i++) {
 				ui64 prime = globals.factor_base[i];
 				ui64 root1 = poly.solutions_mod_p[i];
@@ -369,7 +372,6 @@ namespace Factoriser {
 		}
 	
 		void find_factors_from_relations(QS_global& globals, std::vector<relation> const& relations, std::vector<qs_int>& prime_factors) {
-			using Math::element_in_vector;
 			using Math::gcd;
 			std::vector<CustomBitset> matrix_mod2;
 			prepare_matrix(relations, matrix_mod2);
@@ -377,7 +379,8 @@ namespace Factoriser {
 			std::vector<CustomBitset> solutions;
 			solve_matrix(matrix_mod2, solutions);
 	
-			std::vector<qs_int> divisors;
+			// Hash sets replace the previous linear scans for duplicates
+			std::unordered_set<qs_int> divisors;
 	
 			// NOTE:
 			// Now that the formulas for the smoothness bound and factor base have changed
@@ -387,18 +390,21 @@ namespace Factoriser {
 			int solution_count = 0;
 			const int solution_cap = 50;
 			if (debug) std::cout << "Finding factors from " << std::min(solution_cap, int(solutions.size())) << " solutions...";
+			// Every product is modulo N, so all of them are done as residues of a single reducer
+			Math::modular_reducer<qs_int> reducer(globals.N);
+			typedef typename Math::modular_reducer<qs_int>::residue residue;
+			std::vector<residue> factor_base_residues;
+			for (ui64 prime : globals.factor_base) factor_base_residues.push_back(reducer.to_residue(qs_int(prime)));
 			for (CustomBitset& bitset : solutions) {
 				if (solution_count++ > solution_cap) break;
-				qs_int_double res_sols = 1;
-				qs_int_double poly_vals = 1;
+				residue res_sols_residue = reducer.one();
 				// list of exponents of the factor base that make up poly_vals
 				std::vector<ui64> poly_vals_exps(globals.factor_base.size());
 				// If we do not modulo, then we can end up multiplying 10000+ bit values
 				// Thus we continually work with the already square values, which we can modulo throughout
 				for (int i = 0; i < bitset.size; i++) {
 					if (!bitset[i]) continue;
-					res_sols *= relations[i].residue_solution;
-					res_sols %= globals.N;
+					res_sols_residue = reducer.mul(res_sols_residue, reducer.to_residue(relations[i].residue_solution));
 					for (int j = 0; j < globals.factor_base.size(); j++) {
 						poly_vals_exps[j] += relations[i].exponents[j];
 					}
@@ -406,59 +412,58 @@ namespace Factoriser {
 				for (int i = 0; i < globals.factor_base.size(); i++) {
 					assert(poly_vals_exps[i]%2 == 0);
 					// divides exponent by two to already square-root the value
-					poly_vals *= Math::pow_mod<2*bit_size>(globals.factor_base[i], poly_vals_exps[i]>>1, globals.N);
-					poly_vals %= globals.N;
+					poly_vals_exps[i] >>= 1;
 				}
+				// The powers of all primes share their squarings
+				qs_int poly_vals = reducer.from_residue(Math::multi_pow_residue(reducer, std::span<const residue>(factor_base_residues), poly_vals_exps));
+				qs_int res_sols = reducer.from_residue(res_sols_residue);
 				
 				qs_int factor_1, factor_2;
 				if (res_sols > poly_vals) factor_1 = gcd(qs_int(res_sols - poly_vals), globals.N);
 				else factor_1 = gcd(qs_int(poly_vals - res_sols), globals.N);
 	
-				factor_2 = gcd(qs_int(res_sols + poly_vals), globals.N);
+				// Both values are reduced modulo N, so the sum is reduced as well instead of risking an overflow
+				if (res_sols >= globals.N - poly_vals) factor_2 = gcd(qs_int(res_sols - (globals.N - poly_vals)), globals.N);
+				else factor_2 = gcd(qs_int(res_sols + poly_vals), globals.N);
 	
 				// The list of divisors should be relatively sparse when pruned liked this
-				if (factor_1 != 1 && factor_1 != globals.N && !element_in_vector(factor_1, divisors)) {
-					divisors.push_back(factor_1);
-				}
-				if (factor_2 != 1 && factor_2 != globals.N&& !element_in_vector(factor_2, divisors)) {
-					divisors.push_back(factor_2);
-				}
+				if (factor_1 != 1 && factor_1 != globals.N) divisors.insert(factor_1);
+				if (factor_2 != 1 && factor_2 != globals.N) divisors.insert(factor_2);
 			}
 			if (debug) std::cout << divisors.size() << " Unique divisors found | ";
 			// Factorise composite divisors into primes
-			std::vector<qs_int> possible_primes;
+			std::unordered_set<qs_int> possible_primes;
 			{
-				std::vector<qs_int> big_divisors;
+				std::unordered_set<qs_int> big_divisors;
 				// First we sort out prime divisors and small primes in composites
-				for (qs_int& divisor : divisors) {
+				for (qs_int divisor : divisors) {
 					// skip prime divisors
-					if (Basic::is_prime(divisor) && !element_in_vector(divisor, possible_primes)) {
-						possible_primes.push_back(divisor);
+					if (Basic::is_prime(divisor)) {
+						possible_primes.insert(divisor);
 						continue;
 					}
 	
 					// get small primes and add them to possible factors
 					for (ui64 prime : Basic::trial_division(divisor)) {
 						divisor /= prime;
-						if (!element_in_vector(divisor, possible_primes)) possible_primes.push_back(prime);
+						possible_primes.insert(prime);
 					}
 					if (divisor == 1) continue;
-					if (Basic::is_prime(divisor)) possible_primes.push_back(divisor);
-					else if (!element_in_vector(divisor, big_divisors)) big_divisors.push_back(divisor);
+					if (Basic::is_prime(divisor)) possible_primes.insert(divisor);
+					else big_divisors.insert(divisor);
 				}
 	
 				// now we sort out big divisors individually
 				QuadraticSieve QS;
-				for (qs_int& divisor : big_divisors) {
+				for (qs_int const& divisor : big_divisors) {
 					if (debug) std::cout << std::endl << "Divisor " << divisor << " is being recursively factored by a new quadratic sieve instance!";
-					for (qs_int prime : QS.factorise(divisor)) {
-						divisor /= prime;
-						if (!element_in_vector(divisor, possible_primes)) possible_primes.push_back(prime);
+					for (qs_int const& prime : QS.factorise(divisor)) {
+						possible_primes.insert(prime);
 					}
 				}
 				if (big_divisors.size() && debug) std::cout << std::endl;
 			}
-			for (qs_int& factor : possible_primes) {
+			for (qs_int const& factor : possible_primes) {
 				while (globals.N%factor == 0) {
 					globals.N /= factor;
 					prime_factors.push_back(factor);
@@ -3,12 +3,10 @@
 #include <fstream>
 #include <cstdint>
 #include <vector>
-#include "../int_limited.hpp"
+#include "factoriser_integer.hpp"
 #include "factoriser_math.hpp"
 
 namespace Factoriser::Basic {
-	using largeNumberLibrary::int_limited;
-
 	
 	// Adds all primes smaller or equal to max_val into the argument `primes`
 	// Uses the sieve of Eratosthenes
@@ -57,12 +55,12 @@ namespace Factoriser::Basic {
 	}
 
 	// Finds all factors less than or equal to 1000000, or the given upper_bound
-	template<int bit_size>
-	std::vector<uint64_t> trial_division(int_limited<bit_size> value, uint64_t upper_bound = 1000000) {
+	template<integer_backend T>
+	std::vector<uint64_t> trial_division(T value, uint64_t upper_bound = 1000000) {
 		std::vector<uint64_t> factors;
 		// to guarantee that a prime number larger than upper_bound is found
 		if (!primes.size() || primes.back() < upper_bound) prepare_primes(2*upper_bound);
-		int_limited<bit_size> max = value.isqrt()+1;
+		T max = Math::isqrt(value)+1;
 		for (uint64_t prime : primes) {
 			if (prime > upper_bound) break;
 			if (max < prime) {
@@ -74,7 +72,7 @@ namespace Factoriser::Basic {
 				value /= prime;
 			}
 			if (value == 1) break;
-			max = value.isqrt()+1;
+			max = Math::isqrt(value)+1;
 		}
 		return factors;
 	}
@@ -96,11 +94,11 @@ namespace Factoriser::Basic {
 
 	// Simple trial division, should work up to 10^12
 	// Returns false is value is composite or unable to be determined
-	template<int bit_size>
-	bool is_small_prime(int_limited<bit_size> value, uint64_t upper_bound = 1000000) {
+	template<integer_backend T>
+	bool is_small_prime(T value, uint64_t upper_bound = 1000000) {
 		// to guarantee that a prime number larger than upper_bound is found
 		if (!primes.size() || primes.back() < upper_bound) prepare_primes(2*upper_bound);
-		int_limited<bit_size> max = value.isqrt()+1;
+		T max = Math::isqrt(value)+1;
 		for (uint64_t prime : primes) {
 			if (prime > max) return true;
 			if (prime > upper_bound) break;
@@ -111,40 +109,43 @@ namespace Factoriser::Basic {
 	}
 
 	// A probabilistic Miller-Rabin primality test
-	template<int bit_size>
-	bool Miller_Rabin_test(int_limited<bit_size> const& n, uint64_t iterations = 25) {
-		int_limited<2*bit_size> n_big = n;
-		int_limited<2*bit_size> n_sub = n_big-1;
-		int_limited<2*bit_size> d = n_sub;
+	// Every base is exponentiated and squared with the same Math::modular_reducer (e.g. in the Montgomery form for int_limited),
+	// so n can use the whole bit size of the type
+	template<integer_backend T>
+	bool Miller_Rabin_test(T const& n, uint64_t iterations = 25) {
+		T n_sub = n-1;
+		T d = n_sub;
 		uint64_t s = 0;
 		while ((uint64_t(d)&1) == 0) {
 			d >>= 1;
 			s++;
 		}
-		int_limited<2*bit_size> base_a = Math::random_64();
+		Math::modular_reducer<T> reducer(n);
+		std::vector<uint64_t> d_limbs = Math::exponent_limbs(d);
+		// The residues are unique, so they can be compared directly
+		typename Math::modular_reducer<T>::residue one = reducer.one();
+		typename Math::modular_reducer<T>::residue minus_one = reducer.to_residue(n_sub);
 		for (int i = 0; i < iterations; i++) {
-			int_limited<2*bit_size> a = Math::pow_mod<2*bit_size>(base_a, d, n_big);
-			if (a == 1 || a == n_sub) continue; // is a strong probable prime to base a
+			// Shifting the previous base could overflow the type, so each base is a new random value
+			T base_a = T(Math::random_64()) % n;
+			typename Math::modular_reducer<T>::residue a = Math::pow_residue(reducer, reducer.to_residue(base_a), d_limbs);
+			if (a == one || a == minus_one) continue; // is a strong probable prime to base a
 			int j = 1;
 			for (; j < s; j++) {
-				a = a*a%n_big;
-				if (a == n_sub) break;
+				a = reducer.mul(a, a);
+				if (a == minus_one) break;
 			}
 			if (j == s) return false; // isn't a strong probably prime, thus it is composite
-			base_a <<= 32;
-			if (base_a < 0) base_a >>= 1;
-			base_a ^= Math::random_64();
-			base_a %= n_big;
 		}
 		return true;
 	}
 
-	template<int bit_size>
-	bool is_prime(int_limited<bit_size> const& N) {
+	template<integer_backend T>
+	bool is_prime(T const& N) {
 		if (N == 1) return false;
 		if (N == 2) return true;
 		if ((uint64_t(N)&1) == 0) return false;
-		if (N.ilog2() < 40) return is_small_prime(uint64_t(N), 1000000);
+		if (Math::ilog2(N) < 40) return is_small_prime(uint64_t(N), 1000000);
 		return Miller_Rabin_test(N);
 	}
 }
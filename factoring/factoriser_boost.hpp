@@ -0,0 +1,17 @@
+#pragma once
+#include <boost/multiprecision/cpp_int.hpp>
+#include "factoriser_integer.hpp"
+
+// Allows using boost::multiprecision::cpp_int as the integer type of the factoriser
+// Kept separate from factoriser_integer.hpp, so that the factoriser itself doesn't depend on boost
+namespace Factoriser {
+	// cpp_int is arbitrary precision, so the product in mul_mod can never overflow
+	template<>
+	struct integer_adapter<boost::multiprecision::cpp_int> {
+		typedef boost::multiprecision::cpp_int value_type;
+
+		static value_type isqrt(value_type const& value) { return boost::multiprecision::sqrt(value); }
+		static int ilog2(value_type const& value) { return value == 0 ? 0 : int(boost::multiprecision::msb(value)) + 1; }
+		static value_type mul_mod(value_type const& a, value_type const& b, value_type const& p) { return a*b % p; }
+	};
+}
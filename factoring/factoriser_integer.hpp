@@ -0,0 +1,89 @@
+#pragma once
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include "../int128.hpp"
+#include "../int_limited.hpp"
+
+namespace Factoriser {
+	using largeNumberLibrary::int128;
+	using largeNumberLibrary::uint128;
+	using largeNumberLibrary::int_limited;
+	using largeNumberLibrary::uint_limited;
+
+	// The operations the factoriser needs from an integer type, which aren't operators
+	// isqrt(value) - the floor of the square root
+	// ilog2(value) - the amount of bits used by value (floor(log2(value)) + 1), which is what ilog2() of the library types returns
+	// and what the heuristics of the quadratic sieve were tuned with
+	// mul_mod(a, b, p) - (a*b) mod p, without overflowing for any a, b smaller than the maximum value of the type
+	// Only declared, so that a type without a specialization doesn't satisfy integer_backend
+	template<typename T>
+	struct integer_adapter;
+
+	template<int bit_size, bool is_signed>
+	struct integer_adapter<int_limited<bit_size, is_signed>> {
+		typedef int_limited<bit_size, is_signed> value_type;
+		typedef uint_limited<2*bit_size> double_type;
+
+		static value_type isqrt(value_type const& value) { return value.isqrt(); }
+		static int ilog2(value_type const& value) { return value.ilog2(); }
+		// The product is calculated from views of both values with twice the bit size, so it is never truncated
+		static value_type mul_mod(value_type const& a, value_type const& b, value_type const& p) {
+			return value_type(double_type::multiply(a.view(), b.view()) % double_type(p));
+		}
+	};
+
+	template<>
+	struct integer_adapter<uint128> {
+		static uint128 isqrt(uint128 const& value) { return value.isqrt(); }
+		static int ilog2(uint128 const& value) { return value.ilog2(); }
+		static uint128 mul_mod(uint128 const& a, uint128 const& b, uint128 const& p) { return uint128::mulMod(a, b, p); }
+	};
+
+	// All values in the factoriser are non-negative, so the product can be calculated as uint128
+	template<>
+	struct integer_adapter<int128> {
+		static int128 isqrt(int128 const& value) { return value.isqrt(); }
+		static int ilog2(int128 const& value) { return value.ilog2(); }
+		static int128 mul_mod(int128 const& a, int128 const& b, int128 const& p) {
+			return int128(uint128::mulMod(uint128(a), uint128(b), uint128(p)));
+		}
+	};
+
+	// Describes an integer type that the factoriser (Basic::, Math::, QuadraticSieve and factorise()) can work with
+	// Besides arithmetic and comparison (also with uint64_t), the type has to be convertible to uint64_t (keeping the lowest 64 bits),
+	// hashable (for std::unordered_set) and have an integer_adapter
+	template<typename T>
+	concept integer_backend = std::totally_ordered<T> && std::convertible_to<uint64_t, T>
+		&& requires (T value, T const& other, uint64_t small, int shift) {
+			{ T(value + other) }; { T(value - other) }; { T(value * other) }; { T(value / other) }; { T(value % other) };
+			{ value += other }; { value -= other }; { value *= other }; { value /= other }; { value %= other };
+			{ T(value << shift) }; { T(value >> shift) }; { value <<= shift }; { value >>= shift };
+			{ T(value % small) }; { value /= small };
+			{ value == small } -> std::convertible_to<bool>;
+			{ value < small } -> std::convertible_to<bool>;
+			{ uint64_t(other) };
+			{ std::hash<T>()(other) } -> std::convertible_to<std::size_t>;
+			{ integer_adapter<T>::isqrt(other) } -> std::convertible_to<T>;
+			{ integer_adapter<T>::ilog2(other) } -> std::convertible_to<int>;
+			{ integer_adapter<T>::mul_mod(other, other, other) } -> std::convertible_to<T>;
+		};
+
+	namespace Math {
+		template<integer_backend T>
+		T isqrt(T const& value) {
+			return integer_adapter<T>::isqrt(value);
+		}
+
+		template<integer_backend T>
+		int ilog2(T const& value) {
+			return integer_adapter<T>::ilog2(value);
+		}
+
+		// Calculates (a*b) mod p without overflowing
+		template<integer_backend T>
+		T mul_mod(T const& a, T const& b, T const& p) {
+			return integer_adapter<T>::mul_mod(a, b, p);
+		}
+	}
+}
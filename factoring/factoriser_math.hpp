@@ -1,31 +1,201 @@
 #pragma once
+#include <algorithm>
+#include <bit>
 #include <cstdint>
-#include "../int_limited.hpp"
+#include <optional>
+#include <span>
+#include <vector>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "../modular.hpp"
+#include "../number_traits.hpp"
+#include "factoriser_integer.hpp"
 
 namespace Factoriser::Math {
-	using largeNumberLibrary::int_limited;
 
-	// Calculates (n^exp) mod p without losing precision
-	// Throws an error if there is a potential precision loss
+	// Calculates (a*b) mod p, the product is kept in 128 bits, so it never overflows
+	uint64_t mul_mod(uint64_t a, uint64_t b, uint64_t p) {
+		return uint64_t(uint128(a) * uint128(b) % uint128(p));
+	}
+
+	// Calculates (n^exp) mod p without losing precision (for any 64 bit modulus)
 	uint64_t pow_mod(uint64_t n, uint64_t exp, uint64_t p) {
-		if (exp == 1) return n%p;
-		if (exp == 0) return 1;
-		if (n > UINT32_MAX) throw std::overflow_error("Error: pow_mod() with n = " + std::to_string(n) + " may overflow");
-		if (exp % 2) return (pow_mod(n, exp-1, p) * n) % p;
-		n = pow_mod(n, exp/2, p);
-		return (n * n) % p;
+		uint64_t result = 1 % p;
+		n %= p;
+		while (exp) {
+			if (exp&1) result = mul_mod(result, n, p);
+			exp >>= 1;
+			if (exp) n = mul_mod(n, n, p);
+		}
+		return result;
+	}
+
+	// Repeated multiplication modulo a fixed p
+	// Values are converted into a residue once, multiplied as residues and converted back at the end
+	// residue - the type of the converted values (two equal values always have equal residues)
+	// to_residue(value), from_residue(residue), mul(a, b), one()
+	// The generic version keeps the values as they are and multiplies them with mul_mod
+	template<integer_backend T>
+	class modular_reducer {
+		T p;
+	public:
+		typedef T residue;
+
+		explicit modular_reducer(T const& modulus) : p(modulus) {}
+
+		residue to_residue(T const& value) const { return value < p ? value : T(value % p); }
+		T from_residue(residue const& value) const { return value; }
+		residue mul(residue const& a, residue const& b) const { return mul_mod(a, b, p); }
+		residue one() const { return to_residue(1); }
+	};
+
+	// int_limited, int128 and uint128 are reduced at their own bit size on 64 bit limbs (without the double width product of mul_mod)
+	// An odd modulus uses Montgomery multiplication (the residues are in the Montgomery form), an even one Barrett reduction
+	template<integer_backend T>
+	requires (!std::is_integral_v<T>) && requires { largeNumberLibrary::number_traits<T>::bitSize; }
+	class modular_reducer<T> {
+		static constexpr int bit_size = largeNumberLibrary::number_traits<T>::bitSize;
+		typedef uint_limited<bit_size> value_type;
+		typedef largeNumberLibrary::MontgomeryContext<bit_size> montgomery_type;
+		typedef largeNumberLibrary::BarrettContext<bit_size> barrett_type;
+
+		std::optional<montgomery_type> montgomery;
+		std::optional<barrett_type> barrett;
+	public:
+		typedef typename montgomery_type::limbArray residue;
+
+		// All values in the factoriser are non-negative, so signed values are converted as they are
+		explicit modular_reducer(T const& modulus) {
+			value_type p = value_type(modulus);
+			if ((uint64_t(p)&1) == 1 && p > 1) montgomery.emplace(p);
+			else barrett.emplace(p);
+		}
+
+		residue to_residue(T const& value) const {
+			if (montgomery) return montgomery_type::toLimbs(montgomery->toMont(value_type(value)));
+			return barrett_type::toLimbs(barrett->reduce(value_type(value)));
+		}
+		T from_residue(residue const& value) const {
+			if (montgomery) return T(montgomery_type::fromLimbs(montgomery->fromMont(value)));
+			return T(montgomery_type::fromLimbs(value));
+		}
+		residue mul(residue const& a, residue const& b) const {
+			if (montgomery) return montgomery->mul(a, b);
+			return barrett->mulMod(a, b);
+		}
+		residue one() const {
+			if (montgomery) return montgomery->one();
+			return to_residue(1);
+		}
+	};
+
+	// Exponents are read as 64 bit limbs (least significant limb first)
+	template<integer_backend T>
+	std::vector<uint64_t> exponent_limbs(T exp) {
+		std::vector<uint64_t> limbs;
+		while (exp != 0) {
+			limbs.push_back(uint64_t(exp));
+			exp >>= 64;
+		}
+		return limbs;
+	}
+
+	enum class pow_mode {
+		// k-ary sliding window, the fewest multiplications
+		sliding_window,
+		// Montgomery ladder, a squaring and a multiplication for every bit of the exponent (independent of the bit values)
+		ladder
+	};
+
+	// Calculates base^exp for a residue of the reducer (the result is also a residue)
+	template<typename reducer>
+	typename reducer::residue pow_residue(reducer const& r, typename reducer::residue const& base, std::span<const uint64_t> exp, pow_mode mode = pow_mode::sliding_window) {
+		typedef typename reducer::residue residue;
+		int bits = 0;
+		for (int i = int(exp.size()) - 1; i >= 0 && bits == 0; i--) {
+			if (exp[i]) bits = 64*i + std::bit_width(exp[i]);
+		}
+		if (bits == 0) return r.one();
+		auto bit = [&exp](int index) { return (exp[index/64] >> (index%64)) & 1; };
+
+		if (mode == pow_mode::ladder) {
+			// Invariant: high = low*base
+			residue low = r.one();
+			residue high = base;
+			for (int i = bits-1; i >= 0; i--) {
+				if (bit(i)) { low = r.mul(low, high); high = r.mul(high, high); }
+				else { high = r.mul(low, high); low = r.mul(low, low); }
+			}
+			return low;
+		}
+
+		// The window sizes are the usual thresholds of the amount of multiplications (e.g. the same as OpenSSL)
+		int window = bits > 671 ? 6 : bits > 239 ? 5 : bits > 79 ? 4 : bits > 23 ? 3 : bits > 7 ? 2 : 1;
+		// odd_powers[i] = base^(2i + 1)
+		std::vector<residue> odd_powers(1 << (window-1), base);
+		if (window > 1) {
+			residue square = r.mul(base, base);
+			for (std::size_t i = 1; i < odd_powers.size(); i++) odd_powers[i] = r.mul(odd_powers[i-1], square);
+		}
+
+		// The result is only set by the first window, so that the squares of one are skipped
+		std::optional<residue> result;
+		for (int i = bits-1; i >= 0;) {
+			if (!bit(i)) {
+				result = r.mul(*result, *result);
+				i--;
+				continue;
+			}
+			// The longest window starting at i (at most window bits), which ends with a set bit
+			int j = std::max(i - window + 1, 0);
+			while (!bit(j)) j++;
+			uint64_t value = 0;
+			for (int k = i; k >= j; k--) value = (value << 1) | bit(k);
+			if (!result) result = odd_powers[value >> 1];
+			else {
+				for (int k = i; k >= j; k--) result = r.mul(*result, *result);
+				result = r.mul(*result, odd_powers[value >> 1]);
+			}
+			i = j-1;
+		}
+		return *result;
 	}
 
 	// Calculates (n^exp) mod p without losing precision
-	// Throws an error if there is a potential precision loss
-	template<int bit_size>
-	int_limited<bit_size> pow_mod(int_limited<bit_size> n, int_limited<bit_size> const& exp, int_limited<bit_size> const& p) {
-		if (exp == 1) return n%p;
-		if (exp == 0) return 1;
-		if (n.ilog2() > bit_size/2) throw std::overflow_error("Error: pow_mod() with n = " + n.toString() + " may overflow");
-		if (uint64_t(exp)&1) return (pow_mod(n, exp-1, p) * n) % p;
-		n = pow_mod(n, exp>>1, p);
-		return (n * n) % p;
+	// The whole exponentiation is done with a single modular_reducer (e.g. in the Montgomery form for int_limited)
+	template<integer_backend T>
+	T pow_mod(T const& n, T const& exp, T const& p, pow_mode mode = pow_mode::sliding_window) {
+		modular_reducer<T> r(p);
+		std::vector<uint64_t> limbs = exponent_limbs(exp);
+		return r.from_residue(pow_residue(r, r.to_residue(n), limbs, mode));
+	}
+
+	// Calculates the product of bases[i]^exps[i] (for residues of the reducer) with Straus' (Shamir's) trick
+	// All powers share the same squarings, so there are only as many squarings as the bits of the largest exponent
+	template<typename reducer>
+	typename reducer::residue multi_pow_residue(reducer const& r, std::span<const typename reducer::residue> bases, std::span<const uint64_t> exps) {
+		typedef typename reducer::residue residue;
+		uint64_t all_bits = 0;
+		for (uint64_t exp : exps) all_bits |= exp;
+		residue result = r.one();
+		for (int i = std::bit_width(all_bits) - 1; i >= 0; i--) {
+			result = r.mul(result, result);
+			for (std::size_t j = 0; j < bases.size(); j++) {
+				if ((exps[j] >> i) & 1) result = r.mul(result, bases[j]);
+			}
+		}
+		return result;
+	}
+
+	// Calculates the product of bases[i]^exps[i] mod p
+	template<integer_backend T>
+	T multi_pow_mod(std::span<const T> bases, std::span<const uint64_t> exps, T const& p) {
+		if (bases.size() != exps.size()) throw std::domain_error("Error: The amount of bases and exponents differ");
+		modular_reducer<T> r(p);
+		std::vector<typename modular_reducer<T>::residue> residues;
+		for (T const& base : bases) residues.push_back(r.to_residue(base));
+		return r.from_residue(multi_pow_residue(r, std::span<const typename modular_reducer<T>::residue>(residues), exps));
 	}
 
 	// Returns the Jacobi symbol for x (mod p)
@@ -71,8 +241,8 @@ namespace Factoriser::Math {
 
 	// Returns whether N is a quadratic residue modulo p
 	// Returns false for N=0 (mod p)
-	template<int bit_size>
-	bool is_quadratic_residue(int_limited<bit_size> const& N, uint64_t p) {
+	template<integer_backend T>
+	bool is_quadratic_residue(T const& N, uint64_t p) {
 		if (p == 2) return uint64_t(N)&1;
 		return calc_Jacobi_symbol(uint64_t(N%p), p) == 1;
 	}
@@ -113,15 +283,15 @@ namespace Factoriser::Math {
 		uint64_t t = pow_mod(N, Q, prime);
 		uint64_t R = pow_mod(N, (Q+1)/2, prime);
 		while (t > 1) {
-			uint64_t t_exp = (t*t) % prime;
+			uint64_t t_exp = mul_mod(t, t, prime);
 			uint64_t i = 1;
-			while (t_exp != 1 && i < M) { t_exp = (t_exp*t_exp)%prime; i++; }
+			while (t_exp != 1 && i < M) { t_exp = mul_mod(t_exp, t_exp, prime); i++; }
 			if (i == M) return 0;
-			uint64_t b = pow_mod(c, 1 << (M-i-1), prime);
+			uint64_t b = pow_mod(c, uint64_t(1) << (M-i-1), prime);
 			M = i;
-			c = (b*b)%prime;
-			t = (t*c)%prime;
-			R = (R*b)%prime;
+			c = mul_mod(b, b, prime);
+			t = mul_mod(t, c, prime);
+			R = mul_mod(R, b, prime);
 		}
 		if (t == 1) return R;
 		return 0;
@@ -130,15 +300,18 @@ namespace Factoriser::Math {
 	// Returns a single solution to x^2 = N (mod p) (the other solution is x2 = p - x1)
 	// If a solution is not found, zero is returned
 	// p must be a prime for the algorithm to work
-	template<int bit_size>
-	uint64_t Tonelli_Shanks(int_limited<bit_size> const& N, uint64_t prime) {
+	template<integer_backend T>
+	uint64_t Tonelli_Shanks(T const& N, uint64_t prime) {
 		return Tonelli_Shanks(uint64_t(N%prime), prime);
 	}
 
-	template<int bit_size>
-	int_limited<bit_size> gcd(int_limited<bit_size> const& a, int_limited<bit_size> const& b) {
-		if (b == 0) return a;
-		return gcd(b, a%b);
+	template<integer_backend T>
+	T gcd(T a, T b) {
+		while (b != 0) {
+			a %= b;
+			std::swap(a, b);
+		}
+		return a;
 	}
 
 	// Either takes a non-zero seed as an input
@@ -1,9 +1,18 @@
 #pragma once
 #include "constants.hpp"
+#include "uint128.hpp"
 #include <cstdint>
 #include <iostream>
 #include <string>
+#include <string_view>
+#include <charconv>
+#include <system_error>
 #include <vector>
+#include <compare>
+#include <functional>
+#include <utility>
+#include <bit>
+#include <type_traits>
 
 namespace largeNumberLibrary {
 	// Two's complement
@@ -24,29 +33,32 @@ namespace largeNumberLibrary {
 				int64_t DONE
 				int DONE
 				uint DONE
+			>> (extraction from stream) DONE
+			from_chars DONE
 			conversion TO:
 				uint64_t DONE
 				int64_t DONE
 				int DONE
 				uint DONE
 				char DONE
-			= (assignment operator) DONE
+			EXPLICIT conversion FROM and TO uint128 DONE
+			= (assignment operator, defaulted) DONE
 			=============================================================
 			*/
 			#pragma region Construction
 
 
-			int128() { B1 = 0; B0 = 0; }
+			constexpr int128() noexcept : B0(0), B1(0) {}
 			// Accepts most significant word first
-			int128(uint64_t a, uint64_t b) {
+			constexpr int128(uint64_t a, uint64_t b) noexcept {
 				B1 = a;
 				B0 = b;
 			}
-			int128(uint64_t a) {
+			constexpr int128(uint64_t a) noexcept {
 				B1 = 0;
 				B0 = a;
 			}
-			int128(int64_t a) {
+			constexpr int128(int64_t a) noexcept {
 				if (a < 0) {
 					B1 = UINT64_MAX;
 				} else {
@@ -54,7 +66,7 @@ namespace largeNumberLibrary {
 				}
 				B0 = a;
 			}
-			int128(int a) {
+			constexpr int128(int a) noexcept {
 				if (a < 0) {
 					B1 = UINT64_MAX;
 				} else {
@@ -62,49 +74,122 @@ namespace largeNumberLibrary {
 				}
 				B0 = a;
 			}
-			int128(unsigned int a) {
+			constexpr int128(unsigned int a) noexcept {
 				B1 = 0;
 				B0 = a;
 			}
-			int128(const char* s) {
+			// Keeps the bits, so values above the maximum become negative
+			constexpr explicit int128(uint128 const& value) noexcept {
+				B1 = uint64_t(value >> 64);
+				B0 = uint64_t(value);
+			}
+			constexpr int128(const char* s) {
+				B1 = 0;
+				B0 = 0;
 				bool negative = false;
 				if (*s != '\0' && *s == '-') {
 					negative = true;
 					s++;
 				}
+				// Up to 19 digits are accumulated in a single word, before multiplying the whole value
 				while (*s != '\0') {
-					const char c = *s;
-					if (c < '0' || c > '9') throw std::domain_error("String to int_limited conversion exception");
-					// multiply by ten
-					*this = ((*this << 2) + *this) << 1;
-					*this += (c-'0');
-					s++;
+					uint64_t chunk = 0;
+					uint64_t multiplier = 1;
+					for (int digit = 0; digit < 19 && *s != '\0'; digit++, s++) {
+						const char c = *s;
+						if (c < '0' || c > '9') throw std::domain_error("String to int128 conversion exception");
+						chunk = chunk*10 + (c-'0');
+						multiplier *= 10;
+					}
+					*this = *this * int128(multiplier) + int128(chunk);
 				}
 				if (negative) *this = ~*this + 1;
 			}
 
+			// Reads a number straight from the stream buffer, without building an intermediate string
+			// Leading whitespace is skipped (unless std::noskipws is set), then an optional '+' or '-'
+			// The base is taken from the stream's basefield (std::dec, std::hex, std::oct)
+			// With std::hex a "0x" prefix is also accepted, and if basefield is unset
+			// the base is detected from a "0x", "0o" or "0b" prefix (otherwise base 10)
+			// If there are no digits, num is set to 0, if the value doesn't fit, it is set to the maximum or minimum value
+			// In both cases failbit is set (same as for the standard integer types)
+			friend std::istream& operator>>(std::istream& is, int128& num) {
+				std::istream::sentry sentry(is);
+				if (!sentry) return is;
+				std::streambuf* buffer = is.rdbuf();
+				bool negative = false;
+				int c = buffer->sgetc();
+				if (c == '+' || c == '-') {
+					negative = c == '-';
+					c = buffer->snextc();
+					// The magnitude has to follow the sign directly, so a second sign is rejected here
+					// and the whitespace isn't skipped when the magnitude is read
+					if (c == '+' || c == '-') {
+						num = int128(0, 0);
+						is.setstate(std::ios_base::failbit);
+						return is;
+					}
+				}
+
+				// The magnitude is parsed as a uint128, which sets 0 if there are no digits and the maximum value on overflow
+				uint128 magnitude;
+				std::ios_base::fmtflags flags = is.flags();
+				is.unsetf(std::ios_base::skipws);
+				is >> magnitude;
+				is.flags(flags);
+				// The magnitude of the minimum value is one larger than the maximum value
+				if (!is.fail() && magnitude > uint128(BIT64_ON, 0) - uint128(!negative)) is.setstate(std::ios_base::failbit);
+
+				if (is.fail() && magnitude == 0) num = int128(0, 0);
+				else if (is.fail()) num = negative ? int128(BIT64_ON, 0) : int128(UINT63_MAX, UINT64_MAX);
+				else {
+					num = int128(magnitude);
+					if (negative) num = -num;
+				}
+				return is;
+			}
+
+			// Parses the longest valid number at the start of [first, last), in the style of std::from_chars
+			// Bases from 2 to 36 are accepted, base 0 detects the base from a "0x", "0o" or "0b" prefix (otherwise base 10)
+			// Instead of throwing, errors are returned in ec (invalid_argument if there are no digits,
+			// result_out_of_range if the value doesn't fit) and value is left unchanged
+			// ptr points to the first character which isn't a part of the number
+			// The magnitude is parsed as a uint128 (19 digits per 64 bit step for base 10)
+			friend constexpr std::from_chars_result from_chars(const char* first, const char* last, int128& value, int base = 10) {
+				bool negative = first != last && *first == '-';
+				uint128 magnitude;
+				std::from_chars_result result = from_chars(first + negative, last, magnitude, base);
+				if (result.ec == std::errc::invalid_argument) return {first, result.ec};
+				// The magnitude of the minimum value is one larger than the maximum value
+				if (result.ec == std::errc::result_out_of_range || magnitude > uint128(BIT64_ON, 0) - uint128(!negative)) {
+					return {result.ptr, std::errc::result_out_of_range};
+				}
+				value = int128(magnitude);
+				if (negative) value = -value;
+				return result;
+			}
+
 			// All explicit conversions simply returns the bits for the given bit amount
 			// For example the minimum value (in two's complement) converted to a int64_t will simply return 0
-			explicit operator uint64_t() const {
+			constexpr explicit operator uint64_t() const noexcept {
 				return B0;
 			}
 			// Simply returns LSB to allow for easier bit manipulation
-			explicit operator int64_t() const {
+			constexpr explicit operator int64_t() const noexcept {
 				return (int64_t)B0;
 			}
-			explicit operator int() const {
+			constexpr explicit operator int() const noexcept {
 				return (int)B0;
 			}
-			explicit operator unsigned int() const {
+			constexpr explicit operator unsigned int() const noexcept {
 				return (unsigned int)B0;
 			}
-			explicit operator char() const {
+			constexpr explicit operator char() const noexcept {
 				return (char)B0;
 			}
-			int128& operator= (int128 const& rhs) {
-				B1 = rhs.B1;
-				B0 = rhs.B0;
-				return *this;
+			// Keeps the bits, so negative values become 2^128 - |value|
+			constexpr explicit operator uint128() const noexcept {
+				return uint128(B1, B0);
 			}
 			#pragma endregion Construction
 
@@ -112,6 +197,8 @@ namespace largeNumberLibrary {
 			SECTION: PRINTING
 			=============================================================
 			className DONE
+			maxDigits DONE
+			to_chars DONE
 			toString DONE
 			<< (insertion to stream) DONE
 			=============================================================
@@ -122,58 +209,59 @@ namespace largeNumberLibrary {
 				return "largeNumberLibrary::int128";
 			}
 
+			// Returns the number of characters (including the sign) of the value with the most digits in the base
+			// so a buffer of this size is always large enough
+			static constexpr int maxDigits(uint64_t base = 10) {
+				if (base < 2) throw std::out_of_range("Unable to convert value to base " + std::to_string(base));
+				uint128 value(BIT64_ON, 0);
+				int digits = 1;
+				do {
+					value /= base;
+					digits++;
+				} while (!!value);
+				return digits;
+			}
+
+			// Writes the value into [first, last) in the style of std::to_chars, without allocating
+			// Bases from 2 to 36 are accepted, '-' is written before negative values regardless of the base
+			// If the buffer is too small, then ec is std::errc::value_too_large and ptr is last
+			// The magnitude is written as a uint128 (in at most three chunks of 10^19 for base 10)
+			friend constexpr std::to_chars_result to_chars(char* first, char* last, int128 const& value, int base = 10) {
+				if (base < 2 || base > 36) return {last, std::errc::invalid_argument};
+				bool sign = value.B1 >= BIT64_ON;
+				// The magnitude is unsigned, so even the minimum value doesn't need special treatment
+				uint128 magnitude(value);
+				if (sign) {
+					if (first == last) return {last, std::errc::value_too_large};
+					magnitude = -magnitude;
+					*first++ = '-';
+				}
+				return to_chars(first, last, magnitude, base);
+			}
+
 			// Returns a string of the current value converted to the desired base
 			// '-' is appended to the start, if the number is negative, regardless of the numerical base
 			// Base is limited to a single unsigned 64 bit integer
-			std::string toString(uint64_t base = 10) {
-				if (base == 0) throw std::out_of_range("Unable to convert value to base 0");
-				// Calculate the bits each word in the numerical base will store
-				int binWordSize = 0;
-				uint64_t base_copy = base;
-				while (base_copy != 0) {
-					base_copy >>= 1;
-					binWordSize++;
-				}
-				// Approximate the largest number of possible words in the numerical base
-				// -1 to binWordSize to account for unfilled bits
-				// +1 at the end to act as a ceil() for cases like base-8 (requires 42.66... words)
-				int maxWordCount = 128/(binWordSize - 1) + 1;
-
-				// Convert this int128 into a vector of base-word-size chunks (yes, it is a bit wasteful for low bases)
-				std::vector<uint64_t> words(maxWordCount, 0);
-				int128 num = *this;
-				bool sign = num < 0;
-				int index = maxWordCount-1;
-				if (sign) num = ~num+1;
-				do {
-					words[index] = (uint64_t)(num%base);
-					num /= base;
-					index--;
-				} while (num != 0);
-
-				// Convert the word-size chunks into the output string
-				std::string output = "";
-				if (sign) output += '-';
-				for (uint64_t word : words) {
-					if (output.size() <= sign && word == 0) continue;
-					if (base < 10) {
-						output += '0' + (char)word;
-					} else if (base < 37) { // the whole alphabet
-						char charWord = '0' + (char)word;
-						if (word > 9) charWord = 'A' + (char)word - 10;
-						output += charWord;
-					} else {
-						output += std::to_string(word) + "_"; // + word divider for clarity
-					}
+			// Bases up to 36 are written with to_chars, larger bases write every digit in base 10 followed by '_'
+			std::string toString(uint64_t base = 10) const {
+				if (base < 2) throw std::out_of_range("Unable to convert value to base " + std::to_string(base));
+				if (base <= 36) {
+					// Base 2 has the most digits
+					char buffer[maxDigits(2)];
+					std::to_chars_result result = to_chars(buffer, buffer + sizeof(buffer), *this, base);
+					return std::string(buffer, result.ptr);
 				}
-				return output;
+				bool sign = B1 >= BIT64_ON;
+				uint128 magnitude(*this);
+				if (sign) magnitude = -magnitude;
+				return (sign ? "-" : "") + magnitude.toString(base);
 			}
 
-			// Note: This overload doesn't take a reference int128&, because it would throw an error when printing a complex expression
-			// For example (a * -1)
-			// It also doesn't consider num as a const, because methods can't be called on consts (at least from my understanding of the error)
-			friend std::ostream& operator<<(std::ostream& os, int128 num) {
-				os << num.toString();
+			// Writes the value in base 10 directly into the stream, from a buffer on the stack
+			friend std::ostream& operator<<(std::ostream& os, int128 const& num) {
+				char buffer[maxDigits()];
+				std::to_chars_result result = to_chars(buffer, buffer + sizeof(buffer), num);
+				os << std::string_view(buffer, result.ptr - buffer);
 				return os;
 			}
 			#pragma endregion Printing
@@ -188,11 +276,12 @@ namespace largeNumberLibrary {
 			/ (division) DONE
 			% (modulus) DONE
 			respective compound operators (+=, -=, *=, /=, %=) DONE
+			divmod DONE
 			=============================================================
 			*/
 			#pragma region Arithmetic
 
-			int128& operator+=(int128 const& rhs) {
+			constexpr int128& operator+=(int128 const& rhs) noexcept {
 				// flags for overflow condition
 				char flag1 = (B0 >= BIT64_ON) + (rhs.B0 >= BIT64_ON);
 				B0 += rhs.B0;
@@ -205,26 +294,35 @@ namespace largeNumberLibrary {
 				B1 += rhs.B1;
 				return *this;
 			}
-			int128 operator+(int128 const& rhs) {
+			constexpr int128 operator+(int128 const& rhs) const noexcept {
 				int128 result(B1, B0);
 				return result += rhs;
 			}
 
-			int128& operator-=(int128 rhs) {
+			constexpr int128& operator-=(int128 rhs) noexcept {
 				return *this += (~rhs + 1);
 			}
-			int128 operator-(int128 rhs) {
+			constexpr int128 operator-(int128 rhs) const noexcept {
 				int128 result(B1, B0);
 				return result += (~rhs + 1);
 			}
 			// negates value
-			int128 operator-() {
+			constexpr int128 operator-() const noexcept {
 				int128 result(B1, B0);
 				return (~result + 1);
 			}
 
-			// We save a bit of time by manually multiplying some parts that are sure to fit within one of the words
-			int128& operator*=(int128 rhs) {
+			// Only the product of the lower words needs the full 128 bits, the cross products only affect B1
+			// If the compiler has a native 128 bit type, the full product of the lower words is a single instruction (mul/mulx on x86-64)
+			// Otherwise we save a bit of time by manually multiplying some parts that are sure to fit within one of the words
+			constexpr int128& operator*=(int128 rhs) noexcept {
+				#if defined(__SIZEOF_INT128__)
+				unsigned __int128 lowProduct = (unsigned __int128)B0 * rhs.B0;
+				// We ignore B1*rhs.B1, because it completely overflows anyway
+				B1 = B1 * rhs.B0 + B0 * rhs.B1 + uint64_t(lowProduct >> 64);
+				B0 = uint64_t(lowProduct);
+				return *this;
+				#else
 				int128 multiplicand(B1, B0);
 				// We ignore B1*rhs.B1, because it completely overflows anyway
 				B1 = multiplicand.B1 * rhs.B0;
@@ -253,299 +351,49 @@ namespace largeNumberLibrary {
 				*this += (z1 << 32);
 
 				return *this;
+				#endif
 			}
-			int128 operator*(int128 const& rhs) {
+			constexpr int128 operator*(int128 const& rhs) const noexcept {
 				int128 result(B1, B0);
 				return result *= rhs;
 			}
 
 			// Division truncates towards zero (just like C and boost)
-			int128& operator/=(int128 divisor) {
-				if (divisor == 0) throw std::domain_error("Divide by zero exception");
-				int128 dividend(B1, B0);
-				// sets sign bit
-				bool sign = (B1 ^ divisor.B1) >= BIT64_ON;
-				B1 = 0;
-				B0 = 0;
-				// convert all to positive
-				if (dividend < 0) dividend = ~dividend + 1;
-				if (divisor < 0) divisor = ~divisor + 1;
-
-				if (divisor > dividend) return *this;
-				if (divisor.B1 == 0 && dividend.B1 == 0) {
-					B0 = dividend.B0 / divisor.B0;
-					if (sign) *this = ~(*this) + 1;
-					return *this;
-				}
-				// if the divisor only consists of one 32-bit word, then divide manually
-				if (divisor < 0x100000000) {
-					uint64_t div = divisor.B0;
-					// curWord contains the remainder from the preceding step in the first 32 bits
-					// and then the current word from the dividend in the last 32 bits
-					uint64_t curWord = (dividend.B1 >> 32);
-					B1 |= (curWord / div) << 32;
-					curWord = ((curWord % div) << 32) | (dividend.B1 & UINT32_MAX);
-					B1 |= curWord / div;
-					curWord = ((curWord % div) << 32) | (dividend.B0 >> 32);
-					B0 |= (curWord / div) << 32;
-					curWord = ((curWord % div) << 32) | (dividend.B0 & UINT32_MAX);
-					B0 |= curWord / div;
-
-					if (sign) *this = ~(*this) + 1;
-					return *this;
-				}
-
-				// This is an implementation of the division algorithm described
-				// in pages 272-273 in Knuth's Art of Computer Programming - Volume 2
-				// u is the dividend, v is the divisor, q is the quotient
-				std::vector<uint32_t> u = {uint32_t(dividend.B0 & UINT32_MAX), uint32_t(dividend.B0 >> 32), uint32_t(dividend.B1 & UINT32_MAX), uint32_t(dividend.B1 >> 32), 0};
-				std::vector<uint32_t> v = {uint32_t(divisor.B0 & UINT32_MAX), uint32_t(divisor.B0 >> 32), uint32_t(divisor.B1 & UINT32_MAX), uint32_t(divisor.B1 >> 32)};
-				std::vector<uint32_t> q = {0, 0, 0, 0};
-				int uInd = 4;
-				int vInd = 3;
-				while (u[uInd] == 0) uInd--;
-				while (v[vInd] == 0) vInd--;
-				
-				// the most significant word of v has to be at least 31 bits
-				// the following code counts the number of leading zeros
-				// inspired by https://stackoverflow.com/revisions/66486689/4
-				uint64_t copyDiv = v[vInd];
-				int shiftCount = 32;
-				for (int curShift = 16; curShift > 1; curShift/=2) {
-					int y = copyDiv >> curShift;
-					if (y != 0) {
-						shiftCount -= curShift;
-						copyDiv = y;
-					}
-				}
-				if (copyDiv >> 1 != 0) shiftCount -= 2;
-				else shiftCount -= copyDiv;
-				// the original divisor is also shifted to help calculate the remainder faster
-				if (shiftCount != 0) {
-					divisor <<= shiftCount;
-					v[vInd] <<= shiftCount;
-					for (int curInd = vInd; curInd > 0; curInd--) {
-						v[curInd] |= v[curInd - 1] >> (32 - shiftCount);
-						v[curInd - 1] <<= shiftCount;
-					}
-					for (int curInd = 4; curInd > 0; curInd--) {
-						u[curInd] |= u[curInd - 1] >> (32 - shiftCount);
-						u[curInd - 1] <<= shiftCount;
-					}
-				}
-				// uInd shouldn't be updated after the shift
-				// Because the original value is required for j
-
-				for (int j = uInd - vInd; j >= 0; j--) {
-					uint64_t curDigits = ((uint64_t(u[j + vInd + 1]) << 32) | u[j + vInd]);
-					if (uint64_t(v[vInd]) > curDigits) {
-						q[j] = 0;
-						continue;
-					}
-					// quotient estimate and remainder
-					uint64_t qEst = curDigits / v[vInd];
-					uint64_t rem = curDigits - qEst * v[vInd];
-					if (qEst > UINT32_MAX || 
-					(qEst * v[vInd - 1]) > ((rem << 32) | u[j + vInd - 1])) {
-						qEst--;
-						rem += v[vInd];
-						// repeat the test until it fails (rem > UINT32_MAX results in failure)
-						while (rem <= UINT32_MAX) {
-							if ((qEst * v[vInd - 1]) > ((rem << 32) | u[j + vInd - 1])) {
-								qEst--;
-								rem += v[vInd];
-							} else {
-								break;
-							}
-						}
-					}
-					
-					int128 difference = divisor * qEst;
-					// The first four 32 bit words are obtained from difference
-					// the fifth word is calculated by itself, since it is outside of 128 bit precision
-					std::vector<uint32_t> diff = {uint32_t(difference.B0 & UINT32_MAX), uint32_t(difference.B0 >> 32), uint32_t(difference.B1 & UINT32_MAX), uint32_t(difference.B1 >> 32), uint32_t(((divisor.B1 >> 32) *qEst) >> 32)};
-					// subtract difference with borrow
-					bool borrow = false;
-					for (int curInd = 0; curInd <= vInd + 1; curInd++) {
-						bool flag1 = diff[curInd] > u[j + curInd];
-						bool flag2 = (diff[curInd] == u[j + curInd]) && borrow;
-						u[j + curInd] -= diff[curInd] + borrow;
-						borrow = flag1 || flag2;
-					}
-					q[j] = qEst;
-					// If the result is negative, add the divisor back once
-					if (borrow) {
-						// 32-bit complement
-						for (int curInd = 0; curInd <= vInd + 1; curInd++) {
-							u[j + curInd] = UINT32_MAX - u[j + curInd];
-						}
-						q[j]--;
-						bool carry = false;
-						for (int curInd = 0; curInd <= vInd; curInd++) {
-							// INT32_MIN in this context is BIT32_ON
-							char flag1 = (v[curInd] >= INT32_MIN) + (u[j + curInd] >= INT32_MIN);
-							u[j + curInd] += v[curInd] + carry;
-							bool flag2 = u[j + curInd] < INT32_MIN;
-							carry = (flag1 + flag2) > 1;
-						}
-						u[j + vInd + 1] += carry;
-					}
-				}
-				// Concatenate the result into an int128
-				B1 = (uint64_t(q[3]) << 32) | q[2];
-				B0 = (uint64_t(q[1]) << 32) | q[0];
-				
-				if (sign) *this = ~*this + 1;
+			constexpr int128& operator/=(int128 const& divisor) {
+				*this = this->divmod(divisor).first;
 				return *this;
 			}
-			int128 operator/(int128 const& rhs) {
+			constexpr int128 operator/(int128 const& rhs) const {
 				int128 result(B1, B0);
 				return result /= rhs;
 			}
 			// Keeps the sign from the dividend (original value)
 			// The sign of the divisor doesn't affect anything
-			int128& operator%=(int128 divisor) {
-				if (divisor == 0) throw std::domain_error("Divide by zero exception");
-				int128 dividend(B1, B0);
-				// sets sign bit
-				bool sign = (B1 >= BIT64_ON);
-				// convert all to positive
-				if (dividend < 0) dividend = ~dividend + 1;
-				if (divisor < 0) divisor = ~divisor + 1;
-
-				if (divisor > dividend) {
-					*this = dividend;
-					if (sign) *this = ~(*this) + 1;
-					return *this;
-				}
-				B1 = 0;
-				// For the most part, this is all a copy of division
-				// where we take the remainder instead of the quotient
-				if (divisor.B1 == 0 && dividend.B1 == 0) {
-					B0 = dividend.B0 % divisor.B0;
-					if (sign) *this = ~(*this) + 1;
-					return *this;
-				}
-
-				// if the divisor only consists of one 32-bit word, then divide manually
-				if (divisor < 0x100000000) {
-					uint64_t div = divisor.B0;
-					// curWord contains the remainder from the preceding step in the first 32 bits
-					// and then the current word from the dividend in the last 32 bits
-					uint64_t curWord = (dividend.B1 >> 32);
-					curWord = ((curWord % div) << 32) | (dividend.B1 & UINT32_MAX);
-					curWord = ((curWord % div) << 32) | (dividend.B0 >> 32);
-					curWord = ((curWord % div) << 32) | (dividend.B0 & UINT32_MAX);
-					B0 = curWord % div;
-
-					if (sign) *this = ~(*this) + 1;
-					return *this;
-				}
-
-				// This is an implementation of the division algorithm described
-				// in pages 272-273 in Knuth's Art of Computer Programming - Volume 2
-				// u is the dividend, v is the divisor, the remainder will be in u at the end
-				std::vector<uint32_t> u = {uint32_t(dividend.B0 & UINT32_MAX), uint32_t(dividend.B0 >> 32), uint32_t(dividend.B1 & UINT32_MAX), uint32_t(dividend.B1 >> 32), 0};
-				std::vector<uint32_t> v = {uint32_t(divisor.B0 & UINT32_MAX), uint32_t(divisor.B0 >> 32), uint32_t(divisor.B1 & UINT32_MAX), uint32_t(divisor.B1 >> 32)};
-				int uInd = 4;
-				int vInd = 3;
-				while (u[uInd] == 0) uInd--;
-				while (v[vInd] == 0) vInd--;
-				
-				// the most significant word of v has to be at least 31 bits
-				// the following code counts the number of leading zeros
-				// inspired by https://stackoverflow.com/revisions/66486689/4
-				uint64_t copyDiv = v[vInd];
-				int shiftCount = 32;
-				for (int curShift = 16; curShift > 1; curShift/=2) {
-					int y = copyDiv >> curShift;
-					if (y != 0) {
-						shiftCount -= curShift;
-						copyDiv = y;
-					}
-				}
-				if (copyDiv >> 1 != 0) shiftCount -= 2;
-				else shiftCount -= copyDiv;
-				// the original divisor is also shifted to help calculate the remainder faster
-				if (shiftCount > 0) {
-					divisor <<= shiftCount;
-					v[vInd] <<= shiftCount;
-					for (int curInd = vInd; curInd > 0; curInd--) {
-						v[curInd] |= v[curInd - 1] >> (32 - shiftCount);
-						v[curInd - 1] <<= shiftCount;
-					}
-					for (int curInd = 4; curInd > 0; curInd--) {
-						u[curInd] |= u[curInd - 1] >> (32 - shiftCount);
-						u[curInd - 1] <<= shiftCount;
-					}
-				}
-				// uInd shouldn't be updated after the shift
-				// Because the original value is required for j
-				
-				for (int j = uInd - vInd; j >= 0; j--) {
-					uint64_t curDigits = ((uint64_t(u[j + vInd + 1]) << 32) | u[j + vInd]);
-					if (uint64_t(v[vInd]) > curDigits) continue;
-					// quotient estimate and remainder
-					uint64_t qEst = curDigits / v[vInd];
-					uint64_t rem = curDigits - qEst * v[vInd];
-					if (qEst > UINT32_MAX || 
-					(qEst * v[vInd - 1]) > ((rem << 32) | u[j + vInd - 1])) {
-						qEst--;
-						rem += v[vInd];
-						// repeat the test until it fails (rem > UINT32_MAX results in failure)
-						while (rem <= UINT32_MAX) {
-							if (qEst > UINT32_MAX ||
-							(qEst * v[vInd - 1]) > ((rem << 32) | u[j + vInd - 1])) {
-								qEst--;
-								rem += v[vInd];
-							} else {
-								break;
-							}
-						}
-					}
-					
-					int128 difference = divisor * qEst;
-					// The first four 32 bit words are obtained from difference
-					// the fifth word is calculated by itself, since it is outside of 128 bit precision
-					std::vector<uint32_t> diff = {uint32_t(difference.B0 & UINT32_MAX), uint32_t(difference.B0 >> 32), uint32_t(difference.B1 & UINT32_MAX), uint32_t(difference.B1 >> 32), uint32_t(((divisor.B1 >> 32) *qEst) >> 32)};
-					// subtract difference with borrow
-					bool borrow = false;
-					for (int curInd = 0; curInd <= vInd + 1; curInd++) {
-						bool flag1 = diff[curInd] > u[j + curInd];
-						bool flag2 = (diff[curInd] == u[j + curInd]) && borrow;
-						u[j + curInd] -= diff[curInd] + borrow;
-						borrow = flag1 || flag2;
-					}
-					// If the result is negative, add the divisor back once
-					if (borrow) {
-						// 32-bit complement
-						for (int curInd = 0; curInd <= vInd + 1; curInd++) {
-							u[j + curInd] = UINT32_MAX - u[j + curInd];
-						}
-						bool carry = false;
-						for (int curInd = 0; curInd <= vInd; curInd++) {
-							// INT32_MIN in this context is BIT32_ON
-							char flag1 = (v[curInd] >= INT32_MIN) + (u[j + curInd] >= INT32_MIN);
-							u[j + curInd] += v[curInd] + carry;
-							bool flag2 = u[j + curInd] < INT32_MIN;
-							carry = (flag1 + flag2) > 1;
-						}
-						u[j + vInd + 1] += carry;
-					}
-				}
-				B1 = (uint64_t(u[3]) << 32) | u[2];
-				B0 = (uint64_t(u[1]) << 32) | u[0];
-				if (shiftCount != 0) {
-					*this >>= shiftCount;
-				}
-				
-				if (sign) *this = ~*this + 1;
+			constexpr int128& operator%=(int128 const& divisor) {
+				*this = this->divmod(divisor).second;
 				return *this;
 			}
-			int128 operator%(int128 const& rhs) {
+			constexpr int128 operator%(int128 const& rhs) const {
 				int128 result(B1, B0);
 				return result %= rhs;
 			}
+			// Returns both the quotient and the remainder (the same as / and %) from a single division
+			constexpr std::pair<int128, int128> divmod(int128 divisor) const {
+				if (divisor.B1 == 0 && divisor.B0 == 0) throw std::domain_error("Divide by zero exception");
+				int128 dividend(B1, B0);
+				bool dividendNegative = B1 >= BIT64_ON;
+				bool divisorNegative = divisor.B1 >= BIT64_ON;
+				// The magnitude of the minimum value is still correct as an unsigned value
+				if (dividendNegative) dividend = ~dividend + 1;
+				if (divisorNegative) divisor = ~divisor + 1;
+
+				// The unsigned division is shared with uint128
+				std::pair<uint128, uint128> magnitudes = uint128(dividend).divmod(uint128(divisor));
+				int128 quotient(magnitudes.first), remainder(magnitudes.second);
+				if (dividendNegative != divisorNegative) quotient = ~quotient + 1;
+				if (dividendNegative) remainder = ~remainder + 1;
+				return {quotient, remainder};
+			}
 			#pragma endregion Arithmetic
 
 			/*
@@ -562,44 +410,44 @@ namespace largeNumberLibrary {
 			*/
 			#pragma region Bitwise
 
-			int128& operator^= (int128 const& rhs) {
+			constexpr int128& operator^= (int128 const& rhs) noexcept {
 				B1 ^= rhs.B1;
 				B0 ^= rhs.B0;
 				return *this;
 			}
-			int128 operator^ (int128 const& rhs) {
+			constexpr int128 operator^ (int128 const& rhs) const noexcept {
 				int128 result(B1 ^ rhs.B1, B0 ^ rhs.B0);
 				return result;
 			}
 
-			int128& operator|= (int128 const& rhs) {
+			constexpr int128& operator|= (int128 const& rhs) noexcept {
 				B1 |= rhs.B1;
 				B0 |= rhs.B0;
 				return *this;
 			}
-			int128 operator| (int128 const& rhs) {
+			constexpr int128 operator| (int128 const& rhs) const noexcept {
 				int128 result(B1 | rhs.B1, B0 | rhs.B0);
 				return result;
 			}
 
-			int128& operator&= (int128 const& rhs) {
+			constexpr int128& operator&= (int128 const& rhs) noexcept {
 				B1 &= rhs.B1;
 				B0 &= rhs.B0;
 				return *this;
 			}
-			int128 operator& (int128 const& rhs) {
+			constexpr int128 operator& (int128 const& rhs) const noexcept {
 				int128 result(B1 & rhs.B1, B0 & rhs.B0);
 				return result;
 			}
 
 			// Returns the bit NOT, so adding 1 gets the two's complement
-			int128 operator~ () {
+			constexpr int128 operator~ () const noexcept {
 				int128 result(~B1, ~B0);
 				return result;
 			}
 
 			// Classic non-arithmetic bitshift
-			int128& operator<<= (unsigned int const& rhs) {
+			constexpr int128& operator<<= (unsigned int const& rhs) noexcept {
 				// Special case, because bitshifting by the bitsize of an integer is undefined (and inconsistent) behaviour
 				if (rhs == 0) return *this;
 
@@ -619,13 +467,13 @@ namespace largeNumberLibrary {
 				return *this;
 			}
 			// Classic non-arithmetic bitshift
-			int128 operator<< (unsigned int const& rhs) {
+			constexpr int128 operator<< (unsigned int const& rhs) const noexcept {
 				int128 result(B1, B0);
 				return result <<= rhs;
 			}
 
 			// Classic non-arithmetic bitshift
-			int128& operator>>= (unsigned int const& rhs) {
+			constexpr int128& operator>>= (unsigned int const& rhs) noexcept {
 				// Special case, because bitshifting by the bitsize of an integer is undefined (and inconsistent) behaviour
 				if (rhs == 0) return *this;
 
@@ -645,7 +493,7 @@ namespace largeNumberLibrary {
 				return *this;
 			}
 			// Classic non-arithmetic bitshift
-			int128 operator>> (unsigned int const& rhs) {
+			constexpr int128 operator>> (unsigned int const& rhs) const noexcept {
 				int128 result(B1, B0);
 				return result >>= rhs;
 			}
@@ -660,17 +508,20 @@ namespace largeNumberLibrary {
 			< (less-than) DONE
 			>= (greater-than-or-equal-to) DONE
 			<= (less-than-or-equal-to) DONE
+			<=> (three-way comparison) DONE
+			compareAbs DONE
+			hash DONE
 			=============================================================
 			*/
 			#pragma region Relational
 
-			bool operator== (int128 const& rhs) {
+			constexpr bool operator== (int128 const& rhs) const noexcept {
 				return (B0 == rhs.B0 && B1 == rhs.B1);
 			}
-			bool operator!= (int128 const& rhs) {
+			constexpr bool operator!= (int128 const& rhs) const noexcept {
 				return (B0 != rhs.B0 || B1 != rhs.B1);
 			}
-			bool operator> (int128 const& rhs) {
+			constexpr bool operator> (int128 const& rhs) const noexcept {
 				// if different signs - false if B1 is negative, true if rhs.B1 is negative
 				if ((B1 & BIT64_ON) != (rhs.B1 & BIT64_ON)) return B1 < rhs.B1;
 				if (B1 == rhs.B1) {
@@ -678,7 +529,7 @@ namespace largeNumberLibrary {
 				}
 				return B1 > rhs.B1;
 			}
-			bool operator< (int128 const& rhs) {
+			constexpr bool operator< (int128 const& rhs) const noexcept {
 				// if different signs - false if B1 is negative, true if rhs.B1 is negative
 				if ((B1 & BIT64_ON) != (rhs.B1 & BIT64_ON)) return B1 > rhs.B1;
 				if (B1 == rhs.B1) {
@@ -686,7 +537,7 @@ namespace largeNumberLibrary {
 				}
 				return B1 < rhs.B1;
 			}
-			bool operator>= (int128 const& rhs) {
+			constexpr bool operator>= (int128 const& rhs) const noexcept {
 				// if different signs - false if B1 is negative, true if rhs.B1 is negative
 				if ((B1 & BIT64_ON) != (rhs.B1 & BIT64_ON)) return B1 < rhs.B1;
 				if (B1 == rhs.B1) {
@@ -694,7 +545,7 @@ namespace largeNumberLibrary {
 				}
 				return B1 >= rhs.B1;
 			}
-			bool operator<= (int128 const& rhs) {
+			constexpr bool operator<= (int128 const& rhs) const noexcept {
 				// if different signs - false if B1 is negative, true if rhs.B1 is negative
 				if ((B1 & BIT64_ON) != (rhs.B1 & BIT64_ON)) return B1 > rhs.B1;
 				if (B1 == rhs.B1) {
@@ -702,6 +553,34 @@ namespace largeNumberLibrary {
 				}
 				return B1 <= rhs.B1;
 			}
+			constexpr std::strong_ordering operator<=> (int128 const& rhs) const noexcept {
+				// if different signs, then the negative value is smaller
+				if ((B1 & BIT64_ON) != (rhs.B1 & BIT64_ON)) return rhs.B1 <=> B1;
+				if (B1 != rhs.B1) return B1 <=> rhs.B1;
+				return B0 <=> rhs.B0;
+			}
+
+			// Compares the absolute values, i.e. |*this| <=> |rhs|
+			// The magnitudes are compared as unsigned values, so MIN_VALUE is the largest magnitude
+			constexpr std::strong_ordering compareAbs(int128 const& rhs) const noexcept {
+				uint64_t A1 = B1, A0 = B0;
+				uint64_t C1 = rhs.B1, C0 = rhs.B0;
+				if (A1 & BIT64_ON) {
+					A1 = ~A1 + (A0 == 0);
+					A0 = ~A0 + 1;
+				}
+				if (C1 & BIT64_ON) {
+					C1 = ~C1 + (C0 == 0);
+					C0 = ~C0 + 1;
+				}
+				if (A1 != C1) return A1 <=> C1;
+				return A0 <=> C0;
+			}
+
+			// Mixes both words with the wyhash mixing function
+			constexpr std::size_t hash() const noexcept {
+				return std::size_t(hashMix(hashMix(B0 ^ HASH_SECRET_1, B1 ^ HASH_SECRET_0) ^ HASH_SECRET_1, HASH_SECRET_0));
+			}
 			#pragma endregion Relational
 
 			/*
@@ -717,15 +596,73 @@ namespace largeNumberLibrary {
 			=============================================================
 			*/
 			#pragma region Logical
-			bool operator! () {
+			constexpr bool operator! () const noexcept {
 				return (B1 == 0 && B0 == 0);
 			}
-			bool operator&& (int128 const& rhs) {
+			constexpr bool operator&& (int128 const& rhs) const noexcept {
 				return ((B1 != 0 || B0 != 0) && (rhs.B1 != 0 || rhs.B0 != 0));
 			}
-			bool operator|| (int128 const& rhs) {
+			constexpr bool operator|| (int128 const& rhs) const noexcept {
 				return (B1 != 0 || B0 != 0 || rhs.B1 != 0 || rhs.B0 != 0);
 			}
 			#pragma endregion Logical
+
+			/*
+			SECTION: MATH
+			=============================================================
+			ilog2 DONE
+			pow DONE
+			isqrt DONE
+			gcd DONE
+			powMod DONE
+
+			> All of them work on the magnitude through uint128
+			=============================================================
+			*/
+			#pragma region Math
+			// returns the amount of bits used by the value (floored binary log + 1)
+			constexpr int ilog2() const {
+				if (B1 >= BIT64_ON || (B1 == 0 && B0 == 0)) throw std::domain_error("Logarithm of non-positive exception");
+				return uint128(B1, B0).ilog2();
+			}
+
+			// only accepts positive exponents, the result wraps around just like multiplication
+			constexpr int128 pow(uint32_t exp) const noexcept {
+				return int128(uint128(B1, B0).pow(exp));
+			}
+
+			// returns the floored value of the square root
+			constexpr int128 isqrt() const {
+				if (B1 >= BIT64_ON) throw std::domain_error("Sqrt of negative value exception");
+				return int128(uint128(B1, B0).isqrt());
+			}
+
+			// Always non-negative, except for gcd(MIN_VALUE, 0) and gcd(MIN_VALUE, MIN_VALUE), where 2^127 doesn't fit
+			static constexpr int128 gcd(int128 a, int128 b) noexcept {
+				if (a.B1 >= BIT64_ON) a = -a;
+				if (b.B1 >= BIT64_ON) b = -b;
+				return int128(uint128::gcd(uint128(a), uint128(b)));
+			}
+
+			// Returns (value^exp) mod modulus in the range [0, modulus), even for negative values
+			constexpr int128 powMod(int128 const& exp, int128 const& modulus) const {
+				if (exp.B1 >= BIT64_ON) throw std::domain_error("Negative exponent exception");
+				if (modulus.B1 >= BIT64_ON || !modulus) throw std::domain_error("Non-positive modulus exception");
+				int128 base = *this % modulus;
+				if (base.B1 >= BIT64_ON) base += modulus;
+				return int128(uint128(base).powMod(uint128(exp), uint128(modulus)));
+			}
+			#pragma endregion Math
 	};
-}
\ No newline at end of file
+
+	// Copying is a plain copy of both words, which allows memcpy-based bulk copies and std::atomic<int128>
+	static_assert(std::is_trivially_copyable_v<int128>);
+}
+
+// Allows int128 to be used in unordered containers
+template <>
+struct std::hash<largeNumberLibrary::int128> {
+	std::size_t operator() (largeNumberLibrary::int128 const& value) const noexcept {
+		return value.hash();
+	}
+};
\ No newline at end of file
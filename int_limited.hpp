@@ -1,13 +1,99 @@
 #pragma once
 #include "constants.hpp"
+#include "int128.hpp"
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <array>
+#include <span>
+#include <bit>
+#include <compare>
+#include <functional>
+#include <unordered_map>
+#include <charconv>
 
 
 namespace largeNumberLibrary {
+	// Non-owning, read-only view of an unsigned value stored in external 32 bit words (LSW first)
+	// For example the words of an int_limited, a record in a memory mapped file or a part of a larger value
+	// The view doesn't own the words, so they have to outlive it
+	// Words past the end of the view are read as zero
+	// Arithmetic with views is done by int_limited (results are always written into owned values)
+	class int_limited_view {
+		private:
+			std::span<const uint32_t> words;
+
+		public:
+			int_limited_view() {}
+			int_limited_view(std::span<const uint32_t> words) : words(words) {}
+			int_limited_view(const uint32_t* data, std::size_t count) : words(data, count) {}
+
+			std::size_t size() const {
+				return this->words.size();
+			}
+			std::span<const uint32_t> span() const {
+				return this->words;
+			}
+			uint32_t operator[] (std::size_t index) const {
+				return index < this->words.size() ? this->words[index] : 0;
+			}
+
+			// Returns a view of count words starting at the word start (both are clamped to the size of the view)
+			int_limited_view slice(std::size_t start, std::size_t count = SIZE_MAX) const {
+				start = std::min(start, this->words.size());
+				count = std::min(count, this->words.size() - start);
+				return int_limited_view(this->words.subspan(start, count));
+			}
+			// Returns the view without its most significant zero words (a zero value has no words)
+			int_limited_view trimmed() const {
+				std::size_t count = this->words.size();
+				while (count > 0 && this->words[count - 1] == 0) count--;
+				return int_limited_view(this->words.first(count));
+			}
+
+			bool operator! () const {
+				return this->trimmed().size() == 0;
+			}
+			// Amount of significant bits (0 for zero)
+			int bitLength() const {
+				int_limited_view value = this->trimmed();
+				if (value.size() == 0) return 0;
+				return int(value.size() - 1) * 32 + std::bit_width(value.words.back());
+			}
+			bool bit(std::size_t index) const {
+				return ((*this)[index / 32] >> (index % 32)) & 1;
+			}
+			// Returns length bits (at most 64) starting at the bit start
+			uint64_t extractBits(std::size_t start, int length) const {
+				if (length < 0 || length > 64) throw std::out_of_range("Invalid length of extracted bits");
+				if (length == 0) return 0;
+				std::size_t index = start / 32;
+				int shift = start % 32;
+				// Three words are needed for 64 bits which aren't aligned to a word
+				uint64_t low = (uint64_t((*this)[index + 1]) << 32) | (*this)[index];
+				uint64_t result = low >> shift;
+				if (shift != 0) result |= uint64_t((*this)[index + 2]) << (64 - shift);
+				if (length < 64) result &= (uint64_t(1) << length) - 1;
+				return result;
+			}
+
+			std::strong_ordering operator<=> (int_limited_view const& rhs) const {
+				int_limited_view lhsTrimmed = this->trimmed();
+				int_limited_view rhsTrimmed = rhs.trimmed();
+				if (lhsTrimmed.size() != rhsTrimmed.size()) return lhsTrimmed.size() <=> rhsTrimmed.size();
+				for (std::size_t i = lhsTrimmed.size(); i-- > 0;) {
+					if (lhsTrimmed.words[i] != rhsTrimmed.words[i]) return lhsTrimmed.words[i] <=> rhsTrimmed.words[i];
+				}
+				return std::strong_ordering::equal;
+			}
+			bool operator== (int_limited_view const& rhs) const {
+				return (*this <=> rhs) == 0;
+			}
+	};
+
 	// Two's complement
 	// Constructs an array of 32 bit unsigned integers, so that the specified bit size fits
 	// If the bitSize isn't a multiple of 32, operations will still be processed for all 32 bits of the most significant word
@@ -16,7 +102,9 @@ namespace largeNumberLibrary {
 	// No further optimizations are made on the most significant word (even if the instance only has 1 word)
 	// All operations occur on class instances with equal bitSize
 	// In case of different sizes, both values are set to the size of the left hand side
-	template <int bitSize>
+	// If isSigned is false, then the value is unsigned (see uint_limited below)
+	// Unsigned instances share all of the same code, only the sign handling is skipped
+	template <int bitSize, bool isSigned = true>
 	class int_limited {
 		private:
 			static const int wordCount = bitSize/32 + (bitSize%32 > 0);
@@ -31,13 +119,14 @@ namespace largeNumberLibrary {
 			int MSW = 0;
 			int LSW = 0;
 
-			// required to simplify division (extra precision)
-			template <int exPr> friend class int_limited;
+			// required to simplify division (extra precision) and conversions between signedness
+			template <int exPr, bool exSigned> friend class int_limited;
 
 			/*
 			SECTION: HELPER FUNCTIONS
 			=============================================================
 			Concat 32 bits to 64 DONE
+			Byte swap DONE
 			Truncate extra bits DONE
 			Update LSW DONE
 			Update MSW DONE
@@ -46,6 +135,11 @@ namespace largeNumberLibrary {
 			Bit Shift Left DONE
 			Bit Shift Right DONE
 			Simple Multiplication DONE
+			Sign check DONE
+			Negation in place DONE
+			Division by a single word DONE
+			Multiply-add of a single word DONE
+			Radix conversion DONE
 			=============================================================
 			*/
 			#pragma region Helper
@@ -54,11 +148,22 @@ namespace largeNumberLibrary {
 				return (uint64_t(A) << 32) | B;
 			}
 
+			// Reverses the byte order of a word (compiles to a single bswap on GCC and Clang)
+			static uint32_t byteSwap(uint32_t word) {
+				#if defined(__GNUC__) || defined(__clang__)
+				return __builtin_bswap32(word);
+				#else
+				return (word >> 24) | ((word >> 8) & 0xFF00) | ((word << 8) & 0xFF0000) | (word << 24);
+				#endif
+			}
+
+			// Values are computed at the word boundary and the bits above bitSize are only cleared
+			// once, when an operation which can set them finishes (always *before* updating MSW)
+			// Compiles to nothing for sizes that are a multiple of 32
 			void truncateExtraBits() {
-				int bitsInMSW = bitSize % 32;
-				if (bitsInMSW == 0) return;
-				this->words[this->wordCount-1] &= UINT32_MAX >> (32 - bitsInMSW);
-				if (this->words[this->wordCount-1] == 0 && this->wordCount > 1) this->updateMSW(this->MSW);
+				if constexpr (bitSize % 32 != 0) {
+					this->words[this->wordCount-1] &= UINT32_MAX >> (32 - bitSize % 32);
+				}
 				return;
 			}
 
@@ -87,9 +192,6 @@ namespace largeNumberLibrary {
 				if (upperBound == -1) upperBound = 0;
 
 				this->MSW = upperBound;
-				if (this->MSW == this->wordCount - 1) {
-					this->truncateExtraBits();
-				}
 				return;
 			}
 			
@@ -106,10 +208,10 @@ namespace largeNumberLibrary {
 			// Shift a single word right by an amount of words
 			void wordShiftRight(int wordIndex, int shift) {
 				if (shift == 0) return;
-				if (wordIndex - shift > -1) {
+				if (wordIndex - shift > -1 && wordIndex < this->wordCount) {
 					this->words[wordIndex - shift] = this->words[wordIndex];
 				}
-				this->words[wordIndex] = 0;
+				if (wordIndex < this->wordCount) this->words[wordIndex] = 0;
 				return;
 			}
 
@@ -128,27 +230,36 @@ namespace largeNumberLibrary {
 			// Expects the shift to be less than or equal to 32 bits
 			void bitShiftRight(int wordIndex, int shift) {
 				if (shift == 0) return;
-				if (wordIndex - 1 > -1) {
+				if (wordIndex - 1 > -1 && wordIndex < this->wordCount) {
 					this->words[wordIndex - 1] |= this->words[wordIndex] << (32 - shift);
 				}
-				if (wordIndex > -1) this->words[wordIndex] >>= shift;
+				if (wordIndex > -1 && wordIndex < this->wordCount) this->words[wordIndex] >>= shift;
 				return;
 			}
 
-			int_limited& basicMult(int_limited const& A, int_limited const& B) {
+			// A and B are expected to be trimmed (no most significant zero words) and must not point into *this
+			int_limited& basicMult(int_limited_view A, int_limited_view B) {
 				*this = 0;
 				if (!A || !B) return *this;
-				for (int b_i = B.LSW; b_i <= B.MSW; b_i++) {
+				const int A_MSW = int(A.size()) - 1;
+				const int B_MSW = int(B.size()) - 1;
+				int A_LSW = 0;
+				while (A[A_LSW] == 0) A_LSW++;
+				int B_LSW = 0;
+				while (B[B_LSW] == 0) B_LSW++;
+				const uint32_t* aWords = A.span().data();
+				const uint32_t* bWords = B.span().data();
+				for (int b_i = B_LSW; b_i <= B_MSW; b_i++) {
 					uint32_t carry = 0;
 					bool secondCarry = false;
-					for (int a_i = A.LSW; a_i <= A.MSW; a_i++) {
+					for (int a_i = A_LSW; a_i <= A_MSW; a_i++) {
 						// If the result is outside of precision, continue
 						if (a_i + b_i >= this->wordCount) continue;
 
 						// If some of the lower 32 bits of the result fit into the integer
 						// Then multiply with only 32 bit precision
 						if (a_i + b_i + 1 == this->wordCount) {
-							this->words[a_i + b_i] +=  A.words[a_i] * B.words[b_i] + carry + secondCarry;
+							this->words[a_i + b_i] +=  aWords[a_i] * bWords[b_i] + carry + secondCarry;
 							// No need to set carry, because it will be out of precision next iteration
 							continue;
 						}
@@ -157,8 +268,8 @@ namespace largeNumberLibrary {
 						// product cannot overflow, unless carry = (UINT32_MAX << 1) + 1
 						uint64_t product = carry;
 						product += secondCarry;
-						uint64_t multiplicand = A.words[a_i];
-						uint32_t multiplier = B.words[b_i];
+						uint64_t multiplicand = aWords[a_i];
+						uint32_t multiplier = bWords[b_i];
 						product += multiplicand * multiplier;
 						char flag1 = (this->words[a_i + b_i] >= BIT32_ON) + ((uint32_t)product >= BIT32_ON);
 						this->words[a_i + b_i] += (uint32_t)product;
@@ -170,19 +281,261 @@ namespace largeNumberLibrary {
 						secondCarry = (flag1 + flag2) > 1;
 					}
 
-					if (b_i + A.MSW + 1 < this->wordCount) {
+					if (b_i + A_MSW + 1 < this->wordCount) {
 						// if (carry + secondCarry) overflows and will fit into precision, then overflow
-						if (secondCarry && (carry == UINT32_MAX) && ((b_i + A.MSW + 2) < this->wordCount)) this->words[b_i + A.MSW + 2] = 1;
+						if (secondCarry && (carry == UINT32_MAX) && ((b_i + A_MSW + 2) < this->wordCount)) this->words[b_i + A_MSW + 2] = 1;
 						// Otherwise simply add regardless of overflow/precision
-						else this->words[b_i + A.MSW + 1] = carry + secondCarry;
+						else this->words[b_i + A_MSW + 1] = carry + secondCarry;
 					}
 
-					// No need to worry about checking for a new carry, because [b_i + A.MSW + 1] is guaranteed to have been empty at this point
+					// No need to worry about checking for a new carry, because [b_i + A_MSW + 1] is guaranteed to have been empty at this point
 				}
-				this->updateLSW(A.LSW); // B in non-zero, so it can only grow
-				this->updateMSW(A.MSW + B.MSW + 1);
+				this->truncateExtraBits();
+				this->updateLSW(A_LSW); // B in non-zero, so it can only grow
+				this->updateMSW(A_MSW + B_MSW + 1);
 				return *this;
 			}
+
+			// Always false for unsigned values
+			bool isNegative() const {
+				if constexpr (!isSigned) return false;
+				return (this->words[this->wordCount-1] >> ((bitSize-1) % 32)) & 1;
+			}
+
+			// Two's complement negation in place, equivalent to *this = ~*this + 1
+			// Words below LSW stay zero, so the +1 only ever carries into the word LSW
+			// This means the value is negated in a single pass (the words above LSW are only inverted)
+			// For small negative values, the words above the magnitude become zero and MSW drops accordingly
+			void negate() {
+				if (!*this) return;
+				// LSW is never above the lowest non-zero word, but skipping zero words keeps the carry correct if it is below
+				int lowest = this->LSW;
+				while (this->words[lowest] == 0) lowest++;
+				this->words[lowest] = ~this->words[lowest] + 1;
+				for (int i = lowest + 1; i < this->wordCount; i++) {
+					this->words[i] = ~this->words[i];
+				}
+				this->truncateExtraBits();
+				this->LSW = lowest;
+				this->updateMSW(this->wordCount - 1);
+				return;
+			}
+
+			// Divides the (unsigned) value by a single word in place and returns the remainder
+			// The quotient and remainder of every step come from the same hardware division
+			uint32_t divideByWord(uint32_t divisor) {
+				uint64_t rem = 0;
+				for (int i = this->MSW; i >= 0; i--) {
+					uint64_t curWord = concatTo64Bit(uint32_t(rem), this->words[i]);
+					this->words[i] = uint32_t(curWord / divisor);
+					rem = curWord % divisor;
+				}
+				this->updateLSW(0);
+				this->updateMSW(this->MSW);
+				return uint32_t(rem);
+			}
+
+			// Calculates *this = *this * multiplier + addend (as unsigned values) in a single pass
+			// Returns true if the result didn't fit into bitSize (the result is truncated regardless)
+			bool multiplyAddWord(uint32_t multiplier, uint32_t addend) {
+				uint64_t carry = addend;
+				for (int i = 0; i <= this->MSW; i++) {
+					uint64_t product = uint64_t(this->words[i]) * multiplier + carry;
+					this->words[i] = uint32_t(product);
+					carry = product >> 32;
+				}
+				bool overflow = false;
+				if (carry != 0) {
+					if (this->MSW + 1 < this->wordCount) this->words[this->MSW + 1] = uint32_t(carry);
+					else overflow = true;
+				}
+				if (bitSize % 32 != 0 && (this->words[this->wordCount-1] >> (bitSize % 32)) != 0) overflow = true;
+				this->truncateExtraBits();
+				this->updateLSW(0);
+				this->updateMSW(this->MSW + 1);
+				return overflow;
+			}
+
+			// Returns the largest power of the base that fits into a word (and sets chunkDigits to its exponent)
+			static uint32_t radixChunk(uint32_t base, int& chunkDigits) {
+				uint32_t chunkBase = base;
+				chunkDigits = 1;
+				while (uint64_t(chunkBase) * base <= UINT32_MAX) {
+					chunkBase *= base;
+					chunkDigits++;
+				}
+				return chunkBase;
+			}
+
+			// Writes the digits of the (unsigned) value in a base of 2^bitsPerDigit, starting from first, and returns the end
+			// Every digit is extracted directly from the words, so no division is required at all
+			char* writeBitDigits(char* first, int bitsPerDigit) const {
+				int bitLength = !*this ? 1 : this->ilog2();
+				int digitCount = (bitLength + bitsPerDigit - 1) / bitsPerDigit;
+				for (int digit = digitCount - 1; digit >= 0; digit--) {
+					int bit = digit * bitsPerDigit;
+					uint64_t window = this->words[bit / 32];
+					// Digits of bases which aren't 2^(divisor of 32) can span two words
+					if (bit / 32 + 1 < this->wordCount) window |= uint64_t(this->words[bit / 32 + 1]) << 32;
+					*first++ = DIGIT_CHARS[(window >> (bit % 32)) & ((1u << bitsPerDigit) - 1)];
+				}
+				return first;
+			}
+
+			// Values with at least this many words are converted to strings by divide-and-conquer
+			// Smaller values are faster to convert one chunk of digits at a time
+			static const int radixSplitWords = 64;
+
+			// Returns the powers chunkBase^(2^k) (as unsigned values) for every k, where the power still fits into bitSize
+			// The powers are computed once per thread for each bitSize and chunkBase
+			static std::vector<int_limited<bitSize, false>> const& radixPowers(uint32_t chunkBase) {
+				thread_local std::unordered_map<uint32_t, std::vector<int_limited<bitSize, false>>> cache;
+				std::vector<int_limited<bitSize, false>>& powers = cache[chunkBase];
+				if (powers.empty()) {
+					powers.push_back(chunkBase);
+					while (2*powers.back().ilog2() <= bitSize) powers.push_back(powers.back() * powers.back());
+				}
+				return powers;
+			}
+
+			// Writes the digits of a single chunk in front of end and returns the position of the first digit
+			// If pad is true, then exactly chunkDigits digits are written (with leading zeroes)
+			static char* writeChunk(char* end, uint32_t chunk, uint32_t base, int chunkDigits, bool pad) {
+				int digit = 0;
+				if (base == 10) {
+					for (; digit + 2 <= chunkDigits && (pad || chunk >= 10); digit += 2) {
+						uint32_t pair = chunk % 100;
+						chunk /= 100;
+						*--end = DECIMAL_DIGIT_PAIRS[2*pair + 1];
+						*--end = DECIMAL_DIGIT_PAIRS[2*pair];
+					}
+				}
+				for (; digit < chunkDigits && (pad || chunk != 0); digit++) {
+					uint32_t curDigit = chunk % base;
+					chunk /= base;
+					if (base <= 36) {
+						*--end = DIGIT_CHARS[curDigit];
+						continue;
+					}
+					*--end = '_'; // word divider for clarity
+					do {
+						*--end = DIGIT_CHARS[curDigit % 10];
+						curDigit /= 10;
+					} while (curDigit != 0);
+				}
+				return end;
+			}
+
+			// Writes the digits of the (unsigned) value in front of end and returns the position of the first digit
+			// If padChunks is non-zero, then exactly padChunks chunks are written (with leading zeroes)
+			// Large values are split by the largest cached power chunkBase^(2^k) and both halves are written recursively
+			// This makes the conversion only as expensive as a few divisions of large values (instead of one per chunk)
+			char* writeDigits(char* end, uint32_t base, uint32_t chunkBase, int chunkDigits, int padChunks = 0) const {
+				if (this->MSW + 1 >= radixSplitWords) {
+					std::vector<int_limited> const& powers = radixPowers(chunkBase);
+					int k = powers.size() - 1;
+					while (k > 0 && powers[k] > *this) k--;
+					if (k > 0) {
+						int_limited high = *this / powers[k];
+						int_limited low = *this % powers[k];
+						end = low.writeDigits(end, base, chunkBase, chunkDigits, 1 << k);
+						return high.writeDigits(end, base, chunkBase, chunkDigits, padChunks > 0 ? padChunks - (1 << k) : 0);
+					}
+				}
+				int_limited num = *this;
+				if (padChunks > 0) {
+					for (int i = 0; i < padChunks; i++) {
+						end = writeChunk(end, num.divideByWord(chunkBase), base, chunkDigits, true);
+					}
+					return end;
+				}
+				// Only the most significant chunk skips its leading zeroes
+				do {
+					uint32_t chunk = num.divideByWord(chunkBase);
+					end = writeChunk(end, chunk, base, chunkDigits, !!num);
+				} while (!!num);
+				return end;
+			}
+
+			// Passes the digits of the (unsigned) value to output(const char* digits, std::size_t length), most significant first
+			// If padChunks is non-zero, then exactly padChunks chunks are passed (with leading zeroes)
+			// Large values are split the same way as in writeDigits, except that the high half is passed first
+			// so only values with less than radixSplitWords words are ever written into a buffer (of a fixed size)
+			template<typename Output>
+			void outputDigits(Output& output, uint32_t base, uint32_t chunkBase, int chunkDigits, int padChunks = 0) const {
+				if (this->MSW + 1 >= radixSplitWords) {
+					std::vector<int_limited> const& powers = radixPowers(chunkBase);
+					int k = powers.size() - 1;
+					while (k > 0 && powers[k] > *this) k--;
+					if (k > 0) {
+						int_limited high = *this / powers[k];
+						int_limited low = *this % powers[k];
+						high.outputDigits(output, base, chunkBase, chunkDigits, padChunks > 0 ? padChunks - (1 << k) : 0);
+						low.outputDigits(output, base, chunkBase, chunkDigits, 1 << k);
+						return;
+					}
+				}
+				// In bases above 2, a value has less digits than bits (even when its chunks are padded)
+				std::array<char, 32*radixSplitWords> buffer;
+				char* end = buffer.data() + buffer.size();
+				char* start = end;
+				int_limited num = *this;
+				int chunks = 0;
+				do {
+					start = writeChunk(start, num.divideByWord(chunkBase), base, chunkDigits, true);
+					chunks++;
+				} while (!!num);
+				if (padChunks > 0) {
+					for (; chunks < padChunks; chunks++) output(ZERO_CHUNK, chunkDigits);
+				} else {
+					while (end - start > 1 && *start == '0') start++;
+				}
+				output(start, end - start);
+			}
+
+			// Parses the decimal digits in [first, last) into the (unsigned) value
+			// Splitting long strings by cached powers (like writeDigits) was measured to be slower at every size,
+			// because multiplying by a single word is much cheaper than multiplying two large values
+			void parseDigits(const char* first, const char* last) {
+				const int chunkDigits = 9;
+				// Up to 9 digits are accumulated in a single word, before multiplying the whole value
+				*this = 0;
+				while (first != last) {
+					uint32_t chunk = 0;
+					uint32_t multiplier = 1;
+					for (int digit = 0; digit < chunkDigits && first != last; digit++, first++) {
+						const char c = *first;
+						if (c < '0' || c > '9') throw std::domain_error("String to int_limited conversion exception");
+						chunk = chunk*10 + (c-'0');
+						multiplier *= 10;
+					}
+					this->multiplyAddWord(multiplier, chunk);
+				}
+				return;
+			}
+
+			// Sets the value from the two words of an int128 or uint128, filling any words above them with the sign
+			// Bits above the bit size are discarded
+			void importWords128(uint64_t low, uint64_t high, bool negative) {
+				const uint32_t parts[4] = {uint32_t(low), uint32_t(low >> 32), uint32_t(high), uint32_t(high >> 32)};
+				const uint32_t fill = negative ? UINT32_MAX : 0;
+				for (int i = 0; i < this->wordCount; i++) {
+					this->words[i] = i < 4 ? parts[i] : fill;
+				}
+				this->truncateExtraBits();
+				this->updateLSW(0);
+				this->updateMSW(this->wordCount - 1);
+			}
+
+			// Checks whether a parsed magnitude fits into this type with the given sign
+			// The magnitude of the minimum value is one larger than the maximum value
+			static bool magnitudeFits(int_limited<bitSize, false> const& magnitude, bool negative) {
+				if constexpr (isSigned) {
+					int_limited<bitSize, false> limit = int_limited<bitSize, false>(1) << (bitSize-1);
+					if (magnitude > limit || (magnitude == limit && !negative)) return false;
+				}
+				return true;
+			}
 			#pragma endregion Helper
 
 		public:
@@ -196,6 +549,9 @@ namespace largeNumberLibrary {
 				int64_t DONE
 				int DONE
 				uint DONE
+				std::string, std::string_view, const char* DONE
+			from_chars DONE
+			>> (extraction from stream) DONE
 			conversion TO:
 				uint64_t DONE
 				int64_t DONE
@@ -206,18 +562,26 @@ namespace largeNumberLibrary {
 			importBits (vector) DONE
 			importBits (vector, startIndex, endIndex, wordOffset) DONE
 			importBits (iterator to iterator) DONE
+			importBits (span of 32 or 64 bit words) DONE
+			importBytes (span of bytes, either endianness) DONE
 			exportBits DONE
+			exportBits (into a span of 32 or 64 bit words) DONE
+			exportBytes (into a span of bytes, either endianness) DONE
+			int_limited_view (construction from a view and view of the words) DONE
+			IMPLICIT conversion FROM int128 and uint128 DONE
+			EXPLICIT conversion TO int128 and uint128 DONE
 			MAX value DONE
 			MIN value DONE
 			=============================================================
 			*/
 			#pragma region Construction
 
-			// Accepts conversions from individual standard int types (doesn't change MSW and LSW)
+			// Accepts conversions from individual standard int types
 			// To convert multiple integers of a type into an int_limited
 			// It is required to declare an instance and call importBits
 
-			// For all of these instances, LSW and MSW are by default zero, which is correct;
+			// LSW and MSW are by default zero, which is correct for the single word types
+			// 64 bit values can have a zero low word, so both are updated
 			int_limited() {
 				static_assert(bitSize > 1, "Invalid int_limited size");
 			}
@@ -225,8 +589,9 @@ namespace largeNumberLibrary {
 				static_assert(bitSize > 1, "Invalid int_limited size");
 				this->words[0] = uint32_t(a);
 				if (wordCount > 1) this->words[1] = a >> 32;
-				this->updateMSW(1);
 				this->truncateExtraBits();
+				this->updateLSW(0);
+				this->updateMSW(1);
 			}
 			int_limited(int64_t a) {
 				static_assert(bitSize > 1, "Invalid int_limited size");
@@ -238,9 +603,10 @@ namespace largeNumberLibrary {
 				}
 				this->words[0] = a & UINT32_MAX;
 				if (wordCount > 1) this->words[1] = a >> 32;
+				this->truncateExtraBits();
+				this->updateLSW(0);
 				if (a > 0) this->updateMSW(1);
 				else this->updateMSW(this->wordCount - 1);
-				this->truncateExtraBits();
 			}
 			int_limited(int a) {
 				static_assert(bitSize > 1, "Invalid int_limited size");
@@ -249,7 +615,7 @@ namespace largeNumberLibrary {
 					for (int i = 0; i < this->wordCount; i++) {
 						this->words[i] = UINT32_MAX;
 					}
-					this->updateMSW(this->wordCount - 1);
+					this->MSW = this->wordCount - 1;
 				}
 				this->words[0] = a;
 				this->truncateExtraBits();
@@ -259,46 +625,181 @@ namespace largeNumberLibrary {
 				this->words[0] = a;
 				this->truncateExtraBits();
 			}
-			int_limited(const char* s) {
+			int_limited(const char* s) : int_limited(std::string_view(s)) {}
+			int_limited(const std::string s) : int_limited(std::string_view(s)) {}
+			int_limited(std::string_view s) {
 				bool negative = false;
-				if (*s != '\0' && *s == '-') {
+				if (s.size() > 0 && s[0] == '-') {
 					negative = true;
-					s++;
+					s.remove_prefix(1);
+				}
+				int_limited<bitSize, false> magnitude;
+				magnitude.parseDigits(s.data(), s.data() + s.size());
+				*this = magnitude;
+				if (negative) this->negate();
+			}
+
+			// Parses the longest valid number at the start of [first, last), in the style of std::from_chars
+			// Bases from 2 to 36 are accepted, base 0 detects the base from a "0x", "0o" or "0b" prefix (otherwise base 10)
+			// A leading '-' is only accepted for signed values
+			// Instead of throwing, errors are returned in ec (invalid_argument if there are no digits,
+			// result_out_of_range if the value doesn't fit) and value is left unchanged
+			// ptr points to the first character which isn't a part of the number
+			// Digits are accumulated into a single word before multiplying the whole value (e.g. 9 digits for base 10)
+			friend std::from_chars_result from_chars(const char* first, const char* last, int_limited& value, int base = 10) {
+				const char* cur = first;
+				bool negative = false;
+				if constexpr (isSigned) {
+					if (cur != last && *cur == '-') {
+						negative = true;
+						cur++;
+					}
+				}
+				if (base == 0) {
+					base = 10;
+					if (last - cur > 2 && cur[0] == '0') {
+						int prefixBase = 0;
+						if (cur[1] == 'x' || cur[1] == 'X') prefixBase = 16;
+						else if (cur[1] == 'o' || cur[1] == 'O') prefixBase = 8;
+						else if (cur[1] == 'b' || cur[1] == 'B') prefixBase = 2;
+						// Without a valid digit after it, the prefix is just a zero followed by a letter
+						if (prefixBase != 0 && DIGIT_VALUES[uint8_t(cur[2])] < prefixBase) {
+							base = prefixBase;
+							cur += 2;
+						}
+					}
 				}
-				while (*s != '\0') {
-					const char c = *s;
-					if (c < '0' || c > '9') throw std::domain_error("String to int_limited conversion exception");
-					// multiply by ten
-					*this = ((*this << 2) + *this) << 1;
-					*this += (c-'0');
-					s++;
+				if (base < 2 || base > 36) return {first, std::errc::invalid_argument};
+
+				const char* digitsStart = cur;
+				int_limited<bitSize, false> magnitude;
+				bool overflow = false;
+				while (cur != last) {
+					uint32_t chunk = 0;
+					uint32_t multiplier = 1;
+					while (cur != last && multiplier <= UINT32_MAX / base) {
+						uint8_t digit = DIGIT_VALUES[uint8_t(*cur)];
+						if (digit >= base) break;
+						chunk = chunk*base + digit;
+						multiplier *= base;
+						cur++;
+					}
+					if (multiplier == 1) break;
+					overflow |= magnitude.multiplyAddWord(multiplier, chunk);
 				}
-				if (negative) *this = ~*this + 1;
-			}
-			int_limited(const std::string s) {
+				if (cur == digitsStart) return {first, std::errc::invalid_argument};
+
+				if (overflow || !magnitudeFits(magnitude, negative)) return {cur, std::errc::result_out_of_range};
+				value = magnitude;
+				if (negative) value.negate();
+				return {cur, std::errc()};
+			}
+
+			// Reads a number straight from the stream buffer, without building an intermediate string
+			// Leading whitespace is skipped (unless std::noskipws is set), then an optional '+' or '-' ('-' only for signed values)
+			// The base is taken from the stream's basefield (std::dec, std::hex, std::oct)
+			// With std::hex a "0x" prefix is also accepted, and if basefield is unset
+			// the base is detected from a "0x", "0o" or "0b" prefix (otherwise base 10)
+			// If there are no digits, value is set to 0, if the value doesn't fit, it is set to MAX_VALUE or MIN_VALUE
+			// In both cases failbit is set (same as for the standard integer types)
+			friend std::istream& operator>>(std::istream& is, int_limited& value) {
+				std::istream::sentry sentry(is);
+				if (!sentry) return is;
+				std::streambuf* buffer = is.rdbuf();
+				std::ios_base::iostate state = std::ios_base::goodbit;
+				const int eof = std::char_traits<char>::eof();
+
+				int c = buffer->sgetc();
 				bool negative = false;
-				int i = 0;
-				if (s.size() > 0 && s[0] == '-') {
-					negative = true;
-					i++;
+				if (c == '+' || (isSigned && c == '-')) {
+					negative = c == '-';
+					c = buffer->snextc();
+				}
+				int base = 0;
+				switch (is.flags() & std::ios_base::basefield) {
+					case std::ios_base::dec: base = 10; break;
+					case std::ios_base::hex: base = 16; break;
+					case std::ios_base::oct: base = 8; break;
+				}
+				bool sawDigit = false;
+				if ((base == 0 || base == 16) && c == '0') {
+					// The zero is a valid number on its own, unless it is followed by a prefix letter
+					sawDigit = true;
+					c = buffer->snextc();
+					int prefixBase = 0;
+					if (c == 'x' || c == 'X') prefixBase = 16;
+					else if (base == 0 && (c == 'o' || c == 'O')) prefixBase = 8;
+					else if (base == 0 && (c == 'b' || c == 'B')) prefixBase = 2;
+					if (prefixBase != 0) {
+						base = prefixBase;
+						sawDigit = false;
+						c = buffer->snextc();
+					}
+				}
+				if (base == 0) base = 10;
+
+				int_limited<bitSize, false> magnitude;
+				bool overflow = false;
+				while (true) {
+					uint32_t chunk = 0;
+					uint32_t multiplier = 1;
+					while (c != eof && multiplier <= UINT32_MAX / base) {
+						uint8_t digit = DIGIT_VALUES[uint8_t(c)];
+						if (digit >= base) break;
+						chunk = chunk*base + digit;
+						multiplier *= base;
+						c = buffer->snextc();
+					}
+					if (multiplier == 1) break;
+					sawDigit = true;
+					overflow |= magnitude.multiplyAddWord(multiplier, chunk);
 				}
-				for (; i < s.size(); i++) {
-					const char c = s[i];
-					if (c < '0' || c > '9') throw std::domain_error("String to int_limited conversion exception");
-					// multiply by ten
-					*this = ((*this << 2) + *this) << 1;
-					*this += (c-'0');
+				if (c == eof) state |= std::ios_base::eofbit;
+
+				if (!sawDigit) {
+					value = 0;
+					state |= std::ios_base::failbit;
+				} else if (overflow || !magnitudeFits(magnitude, negative)) {
+					value = negative ? MIN_VALUE() : MAX_VALUE();
+					state |= std::ios_base::failbit;
+				} else {
+					value = magnitude;
+					if (negative) value.negate();
 				}
-				if (negative) *this = ~*this + 1;
+				is.setstate(state);
+				return is;
 			}
-			template<int rhs_size>
-			int_limited(int_limited<rhs_size> const& rhs) {
-				if (rhs >= 0) this->importBits(rhs.exportBits());
+			// Copies the words of the view (as an unsigned value, any words above the bit size are ignored)
+			explicit int_limited(int_limited_view view) {
+				this->importBits(view.span());
+			}
+			// Negative signed values are sign extended, everything else is zero extended
+			template<int rhs_size, bool rhs_signed>
+			int_limited(int_limited<rhs_size, rhs_signed> const& rhs) {
+				if (!rhs.isNegative()) this->importBits(std::span<const uint32_t>(rhs.words.data(), rhs.MSW + 1));
 				else {
-					this->importBits((~rhs + 1).exportBits());
-					*this = ~(*this) + 1;
+					int_limited<rhs_size, false> magnitude = rhs;
+					magnitude.negate();
+					this->importBits(std::span<const uint32_t>(magnitude.words.data(), magnitude.MSW + 1));
+					this->negate();
 				}
 			}
+			// Conversion between the signed and unsigned type of the same size
+			// Simply copies the bits (i.e. negative values wrap around to large unsigned values)
+			int_limited(int_limited<bitSize, !isSigned> const& rhs) {
+				this->words = rhs.words;
+				this->LSW = rhs.LSW;
+				this->MSW = rhs.MSW;
+			}
+
+			// Only copies the two words, negative int128 values are sign extended
+			// (smaller bit sizes keep the lower bits, the same as the conversion between different sizes)
+			int_limited(int128 const& value) {
+				this->importWords128(uint64_t(value), uint64_t(value >> 64), value < 0);
+			}
+			int_limited(uint128 const& value) {
+				this->importWords128(uint64_t(value), uint64_t(value >> 64), false);
+			}
 
 			// All explicit conversions simply returns the bits for the given bit amount
 			// For example the minimum value (in two's complement) converted to a int64_t will simply return 0
@@ -320,6 +821,17 @@ namespace largeNumberLibrary {
 			explicit operator char() const {
 				return (char)this->words[0];
 			}
+			// Keeps the lower 128 bits, signed values with less than 128 bits are sign extended first
+			explicit operator uint128() const {
+				if constexpr (bitSize < 128) {
+					return uint128(int_limited<128, isSigned>(*this));
+				} else {
+					return uint128((uint64_t(this->words[3]) << 32) | this->words[2], (uint64_t(this->words[1]) << 32) | this->words[0]);
+				}
+			}
+			explicit operator int128() const {
+				return int128(uint128(*this));
+			}
 
 			int_limited& operator= (int_limited const& rhs) {
 				// Will rewrite all bits, because this->wordCount == rhs.wordCount
@@ -340,6 +852,7 @@ namespace largeNumberLibrary {
 				for (int i = newWords.size(); i < this->wordCount; i++) {
 					this->words[i] = 0;
 				}
+				this->truncateExtraBits();
 				this->updateLSW(0);
 				this->updateMSW(newWords.size()-1);
 				return;
@@ -364,6 +877,7 @@ namespace largeNumberLibrary {
 				for (int i = maxWord; i < this->wordCount; i++) {
 					this->words[i] = 0;
 				}
+				this->truncateExtraBits();
 				this->updateLSW(wordOffset);
 				this->updateMSW(endIndex - startIndex + wordOffset + 1);
 				return;
@@ -387,11 +901,92 @@ namespace largeNumberLibrary {
 				for (int i = index; i < this->wordCount; i++) {
 					this->words[i] = 0;
 				}
+				this->truncateExtraBits();
 				this->updateLSW(wordOffset);
 				this->updateMSW(index - 1);
 				return;
 			}
 
+			// Imports words from any contiguous buffer, without requiring a std::vector
+			// Behaves the same as the first overload, except for the optional wordOffset
+			void importBits(std::span<const uint32_t> newWords, int wordOffset = 0) {
+				if (wordOffset < 0) {
+					throw std::range_error("Invalid wordOffset for importBits");
+				}
+				int index = wordOffset;
+				for (int i = 0; i < wordOffset && i < this->wordCount; i++) {
+					this->words[i] = 0;
+				}
+				for (std::size_t i = 0; i < newWords.size() && index < this->wordCount; i++) {
+					this->words[index] = newWords[i];
+					index++;
+				}
+				for (int i = index; i < this->wordCount; i++) {
+					this->words[i] = 0;
+				}
+				this->truncateExtraBits();
+				this->updateLSW(wordOffset);
+				this->updateMSW(index - 1);
+				return;
+			}
+
+			// Every 64 bit word is split into two 32 bit words (the lower half first)
+			// wordOffset is still counted in 32 bit words
+			void importBits(std::span<const uint64_t> newWords, int wordOffset = 0) {
+				if (wordOffset < 0) {
+					throw std::range_error("Invalid wordOffset for importBits");
+				}
+				int index = wordOffset;
+				for (int i = 0; i < wordOffset && i < this->wordCount; i++) {
+					this->words[i] = 0;
+				}
+				for (std::size_t i = 0; i < newWords.size() && index < this->wordCount; i++) {
+					this->words[index++] = uint32_t(newWords[i]);
+					if (index < this->wordCount) this->words[index++] = uint32_t(newWords[i] >> 32);
+				}
+				for (int i = index; i < this->wordCount; i++) {
+					this->words[i] = 0;
+				}
+				this->truncateExtraBits();
+				this->updateLSW(wordOffset);
+				this->updateMSW(index - 1);
+				return;
+			}
+
+			// Treats the bytes as a single unsigned value in the given byte order
+			// Any bytes above the bit size are ignored (the same as any additional words in importBits)
+			// Never allocates, on little endian machines the bytes are copied directly into the words
+			void importBytes(std::span<const uint8_t> bytes, std::endian order = std::endian::big) {
+				const std::size_t byteCount = std::min(bytes.size(), std::size_t(this->wordCount) * 4);
+				this->words = {};
+				if constexpr (std::endian::native == std::endian::little) {
+					if (order == std::endian::little) {
+						std::memcpy(this->words.data(), bytes.data(), byteCount);
+					} else {
+						// The least significant byte is the last one, so we read whole words from the end
+						const uint8_t* end = bytes.data() + bytes.size();
+						std::size_t fullWords = byteCount / 4;
+						for (std::size_t i = 0; i < fullWords; i++) {
+							uint32_t word;
+							std::memcpy(&word, end - 4*(i + 1), 4);
+							this->words[i] = byteSwap(word);
+						}
+						for (std::size_t i = fullWords*4; i < byteCount; i++) {
+							this->words[i / 4] |= uint32_t(end[-1 - std::ptrdiff_t(i)]) << (8 * (i % 4));
+						}
+					}
+				} else {
+					for (std::size_t i = 0; i < byteCount; i++) {
+						uint8_t byte = order == std::endian::little ? bytes[i] : bytes[bytes.size() - 1 - i];
+						this->words[i / 4] |= uint32_t(byte) << (8 * (i % 4));
+					}
+				}
+				this->truncateExtraBits();
+				this->updateLSW(0);
+				this->updateMSW(this->wordCount - 1);
+				return;
+			}
+
 			// For simplicity's sake this function only returns
 			// a vector of unsigned 32 bit integers from the standard library
 			// Currently returns *all* words, even those higher than the Most Significant (used) Word
@@ -403,11 +998,71 @@ namespace largeNumberLibrary {
 				return converted_words;
 			}
 
+			// Writes the words into a caller-provided buffer (least significant word first)
+			// Any words that don't fit into the buffer are discarded, any excess buffer words are set to zero
+			// Returns the amount of words written from *this
+			std::size_t exportBits(std::span<uint32_t> output) const {
+				std::size_t count = std::min(output.size(), std::size_t(this->wordCount));
+				std::memcpy(output.data(), this->words.data(), count * 4);
+				std::fill(output.begin() + count, output.end(), 0);
+				return count;
+			}
+
+			// Same as above, but every two 32 bit words are concatenated into a single 64 bit word
+			std::size_t exportBits(std::span<uint64_t> output) const {
+				std::size_t count = std::min(output.size(), std::size_t(this->wordCount + 1) / 2);
+				for (std::size_t i = 0; i < count; i++) {
+					uint64_t high = 2*i + 1 < std::size_t(this->wordCount) ? this->words[2*i + 1] : 0;
+					output[i] = (high << 32) | this->words[2*i];
+				}
+				std::fill(output.begin() + count, output.end(), 0);
+				return count;
+			}
+
+			// Writes the value as an unsigned value of exactly bytes.size() bytes in the given byte order
+			// Bytes above the bit size are set to zero and bytes that don't fit are discarded
+			// Returns the amount of bytes written from *this (the rest are zero padding)
+			std::size_t exportBytes(std::span<uint8_t> bytes, std::endian order = std::endian::big) const {
+				const std::size_t byteCount = std::min(bytes.size(), std::size_t(this->wordCount) * 4);
+				if constexpr (std::endian::native == std::endian::little) {
+					if (order == std::endian::little) {
+						std::memcpy(bytes.data(), this->words.data(), byteCount);
+						std::fill(bytes.begin() + byteCount, bytes.end(), 0);
+					} else {
+						uint8_t* end = bytes.data() + bytes.size();
+						std::size_t fullWords = byteCount / 4;
+						for (std::size_t i = 0; i < fullWords; i++) {
+							uint32_t word = byteSwap(this->words[i]);
+							std::memcpy(end - 4*(i + 1), &word, 4);
+						}
+						for (std::size_t i = fullWords*4; i < byteCount; i++) {
+							end[-1 - std::ptrdiff_t(i)] = uint8_t(this->words[i / 4] >> (8 * (i % 4)));
+						}
+						std::fill(bytes.begin(), bytes.end() - byteCount, 0);
+					}
+				} else {
+					for (std::size_t i = 0; i < bytes.size(); i++) {
+						uint8_t byte = i < byteCount ? uint8_t(this->words[i / 4] >> (8 * (i % 4))) : 0;
+						if (order == std::endian::little) bytes[i] = byte;
+						else bytes[bytes.size() - 1 - i] = byte;
+					}
+				}
+				return byteCount;
+			}
+
+			// Returns a view of the words up to MSW (the bits of the two's complement representation for negative values)
+			// The view is invalidated by any change to *this
+			int_limited_view view() const {
+				return int_limited_view(this->words.data(), this->MSW + 1);
+			}
+
 			static int_limited MAX_VALUE() {
+				if constexpr (!isSigned) return int_limited(-1);
 				return int_limited(-1) >> 1;
 			}
 
 			static int_limited MIN_VALUE() {
+				if constexpr (!isSigned) return int_limited(0);
 				return int_limited(1) << (bitSize-1);
 			}
 			#pragma endregion Construction
@@ -417,6 +1072,8 @@ namespace largeNumberLibrary {
 			SECTION: PRINTING
 			=============================================================
 			className DONE
+			maxDigits DONE
+			to_chars DONE
 			toString DONE
 			<< (insertion to stream) DONE
 			=============================================================
@@ -424,70 +1081,136 @@ namespace largeNumberLibrary {
 			#pragma region Printing
 
 			static std::string className() {
+				if constexpr (!isSigned) return "largeNumberLibrary::uint_limited<" + std::to_string(bitSize) + ">";
 				return "largeNumberLibrary::int_limited<" + std::to_string(bitSize) + ">";
 			}
 
+			// Upper bound on the amount of characters required to write any value in the base (from 2 to 36), including the sign
+			// k digits always hold at least floor(log2(base^k)) bits, where base^k is the largest power that fits into 64 bits
+			// This overestimates the exact amount by less than k digits (and is exact for powers of two)
+			static constexpr int maxDigits(uint32_t base = 10) {
+				if (std::has_single_bit(base)) {
+					int bitsPerDigit = std::countr_zero(base);
+					return (bitSize + bitsPerDigit - 1) / bitsPerDigit + isSigned;
+				}
+				uint64_t chunkBase = base;
+				int chunkDigits = 1;
+				while (chunkBase <= UINT64_MAX / base) {
+					chunkBase *= base;
+					chunkDigits++;
+				}
+				int chunkBits = std::bit_width(chunkBase) - 1;
+				return chunkDigits * ((bitSize + chunkBits - 1) / chunkBits) + isSigned;
+			}
+
+			// Writes the value into [first, last) in the style of std::to_chars, without allocating
+			// (except for the powers cached by radixPowers, once per thread, when writing very large values)
+			// Bases from 2 to 36 are accepted, '-' is written before negative values irregardless of the base
+			// If the buffer is too small, then ec is std::errc::value_too_large and ptr is last
+			// Powers of two are written by extracting the bits of each digit, other bases by dividing
+			// by the largest power of the base that fits into a word (e.g. 10^9)
+			friend std::to_chars_result to_chars(char* first, char* last, int_limited const& value, int base = 10) {
+				if (base < 2 || base > 36) return {last, std::errc::invalid_argument};
+				bool sign = value.isNegative();
+				// The magnitude is unsigned, so even the minimum value doesn't need special treatment
+				int_limited<bitSize, false> magnitude = value;
+				if (sign) magnitude.negate();
+
+				if (std::has_single_bit(uint32_t(base))) {
+					int bitsPerDigit = std::countr_zero(uint32_t(base));
+					int bitLength = !magnitude ? 1 : magnitude.ilog2();
+					if (last - first < sign + (bitLength + bitsPerDigit - 1) / bitsPerDigit) return {last, std::errc::value_too_large};
+					if (sign) *first++ = '-';
+					return {magnitude.writeBitDigits(first, bitsPerDigit), std::errc()};
+				}
+
+				if (!magnitude) {
+					if (first == last) return {last, std::errc::value_too_large};
+					*first = '0';
+					return {first + 1, std::errc()};
+				}
+				int chunkDigits;
+				uint32_t chunkBase = radixChunk(base, chunkDigits);
+				if (sign) {
+					if (first == last) return {last, std::errc::value_too_large};
+					*first++ = '-';
+				}
+				// The digits are copied straight into the buffer, a few hundred at a time
+				bool fits = true;
+				auto output = [&first, last, &fits](const char* digits, std::size_t length) {
+					if (!fits || std::size_t(last - first) < length) {
+						fits = false;
+						return;
+					}
+					std::memcpy(first, digits, length);
+					first += length;
+				};
+				magnitude.outputDigits(output, base, chunkBase, chunkDigits);
+				if (!fits) return {last, std::errc::value_too_large};
+				return {first, std::errc()};
+			}
+
 			// Returns a string of the current value converted to the desired base
 			// '-' is appended to the start, if the number is negative, irregardless of the base
 			// Base is limited to a single unsigned 32 bit integer
+			// Bases up to 36 are written with to_chars
 			std::string toString(uint32_t base = 10) const {
-				if (base == 0) throw std::out_of_range("Unable to convert value to base 0");
-				// special case, because it requires special attention
-				if (*this == 0) return "0";
-				// Approximate of the largest number of possible words in the chosen base
-				int binWordSize = 0;
-				uint32_t base_copy = base;
-				while (base_copy != 0) {
-					base_copy >>= 1;
-					binWordSize++;
-				}
-				// -1 to binWordSize to account for unfilled bits
-				if (binWordSize > 1) binWordSize--;
-				// +1 at the end to act as a ceil() for special cases
-				int maxWordCount = bitSize/(binWordSize) + 1;
-
-				// Convert this into a vector of uin32_t chunks (a bit wasteful for low bases)
-				std::vector<uint32_t> baseWords(maxWordCount, 0);
-				int_limited num = *this;
-				bool sign = num < 0;
-				bool add = false;
-				if (sign) {
-					add = (num == int_limited::MIN_VALUE());
-					if (add) num += 1;
-					num = ~num+1;
+				if (base < 2) throw std::out_of_range("Unable to convert value to base " + std::to_string(base));
+				if (base <= 36) {
+					std::string output(maxDigits(base), '0');
+					output.resize(to_chars(output.data(), output.data() + output.size(), *this, base).ptr - output.data());
+					return output;
 				}
-				// baseWords will be in MSb first, for ease of conversion to string
-				int index = maxWordCount-1;
-				do {
-					baseWords[index] = (uint32_t)(num%base);
-					num /= base;
-					index--;
-				} while (num != 0 && index >= 0);
-				// Convert the word-size chunks into the string
-				std::string output = "";
-				if (sign) output += '-';
-				for (uint32_t word : baseWords) {
-					// skip leading zeroes
-					if (output.size() <= sign && word == 0) continue;
-					if (base <= 10) {
-						output += '0' + (char)word;
-					} else if (base < 37) { // the whole alphabet
-						char charWord = '0' + (char)word;
-						if (word > 9) charWord = 'A' + (char)word - 10;
-						output += charWord;
-					} else {
-						output += std::to_string(word) + "_"; // + word divider for clarity
+				// special case, because it requires special attention
+				if (!*this) return "0";
+				// Digits of bases larger than 36 are written in base 10 followed by an underscore
+				// Every digit has at least binDigitSize bits
+				int binDigitSize = std::bit_width(base) - 1;
+				int maxDigitCount = bitSize/binDigitSize + 1;
+
+				bool sign = this->isNegative();
+				int_limited<bitSize, false> num = *this;
+				if (sign) num.negate();
+				int chunkDigits;
+				uint32_t chunkBase = radixChunk(base, chunkDigits);
+
+				// The digits are written from the back of the buffer (least significant first)
+				std::string output(maxDigitCount * 11 + sign, '0');
+				char* first = num.writeDigits(output.data() + output.size(), base, chunkBase, chunkDigits);
+				if (sign) *--first = '-';
+				return output.substr(first - output.data());
+			}
+
+			// Writes the value in base 10 into the stream, from a buffer on the stack (if the bit size is small enough)
+			// or directly in pieces of a few hundred digits
+			friend std::ostream& operator<<(std::ostream& os, int_limited const& num) {
+				if constexpr (maxDigits() <= 1024) {
+					std::array<char, maxDigits()> buffer;
+					std::to_chars_result result = to_chars(buffer.data(), buffer.data() + buffer.size(), num);
+					os << std::string_view(buffer.data(), result.ptr - buffer.data());
+				} else {
+					// Larger values are written straight into the stream, a few hundred digits at a time
+					bool sign = num.isNegative();
+					int_limited<bitSize, false> magnitude = num;
+					if (sign) magnitude.negate();
+					int chunkDigits;
+					uint32_t chunkBase = radixChunk(10, chunkDigits);
+					// Padding to the width of the stream requires the length, which costs a second conversion
+					std::streamsize padding = 0;
+					if (os.width() > 0) {
+						std::streamsize length = sign;
+						auto count = [&length](const char*, std::size_t digits) { length += digits; };
+						magnitude.outputDigits(count, 10, chunkBase, chunkDigits);
+						padding = std::max(os.width() - length, std::streamsize(0));
+						os.width(0);
 					}
+					bool padLeft = (os.flags() & std::ios_base::adjustfield) != std::ios_base::left;
+					if (padLeft) for (; padding > 0; padding--) os.put(os.fill());
+					if (sign) os.put('-');
+					auto output = [&os](const char* digits, std::size_t length) { os.write(digits, length); };
+					magnitude.outputDigits(output, 10, chunkBase, chunkDigits);
+					for (; padding > 0; padding--) os.put(os.fill());
 				}
-				if (add) output[output.size()-1] = char(output[output.size()-1] + 1);
-				return output;
-			}
-
-			// Note: This overload doesn't take a reference, because it would throw an error when printing a complex expression
-			// For example (a * -1)
-			// It also doesn't consider num as a const, because methods can't be called on consts (at least from my understanding of the error)
-			friend std::ostream& operator<<(std::ostream& os, int_limited const& num) {
-				os << num.toString();
 				return os;
 			}
 			#pragma endregion Printing
@@ -502,6 +1225,8 @@ namespace largeNumberLibrary {
 			/ (division) DONE
 			% (modulus) DONE
 			respective compound operators (+=, -=, *=, /=, %=) DONE
+			+= and -= of an int_limited_view DONE
+			multiply (two views) DONE
 			=============================================================
 			*/
 			#pragma region Arithmetic
@@ -521,6 +1246,7 @@ namespace largeNumberLibrary {
 					if (this->words[i] != 0) break;
 				}
 
+				this->truncateExtraBits();
 				this->updateLSW(std::min(this->LSW, rhs.LSW));
 				this->updateMSW(std::max(this->MSW, rhs.MSW) + 1); // +1 for potential carry
 				return *this;
@@ -531,16 +1257,58 @@ namespace largeNumberLibrary {
 			}
 
 			int_limited& operator-= (int_limited const& rhs) {
-				return *this += (~rhs + 1);
+				int_limited negated = rhs;
+				negated.negate();
+				return *this += negated;
 			}
 			int_limited operator- (int_limited const& rhs) const {
 				int_limited result = *this;
-				return result += (~rhs + 1);
+				return result -= rhs;
 			}
 			// negates value
 			int_limited operator- () const {
 				int_limited result = *this;
-				return (~result + 1);
+				result.negate();
+				return result;
+			}
+
+			// The view is added (or subtracted) as an unsigned value, without copying it into an int_limited first
+			int_limited& operator+= (int_limited_view rhs) {
+				const int rhsWords = int(std::min(rhs.size(), std::size_t(this->wordCount)));
+				uint64_t carry = 0;
+				int i = 0;
+				for (; i < rhsWords; i++) {
+					carry += uint64_t(this->words[i]) + rhs[i];
+					this->words[i] = uint32_t(carry);
+					carry >>= 32;
+				}
+				for (; carry != 0 && i < this->wordCount; i++) {
+					this->words[i]++;
+					carry = this->words[i] == 0;
+				}
+				this->truncateExtraBits();
+				this->updateLSW(0);
+				this->updateMSW(std::max(this->MSW, i));
+				return *this;
+			}
+			int_limited& operator-= (int_limited_view rhs) {
+				const int rhsWords = int(std::min(rhs.size(), std::size_t(this->wordCount)));
+				uint64_t borrow = 0;
+				int i = 0;
+				for (; i < rhsWords; i++) {
+					uint64_t difference = uint64_t(this->words[i]) - rhs[i] - borrow;
+					this->words[i] = uint32_t(difference);
+					borrow = difference >> 63;
+				}
+				for (; borrow != 0 && i < this->wordCount; i++) {
+					borrow = this->words[i] == 0;
+					this->words[i]--;
+				}
+				this->truncateExtraBits();
+				this->updateLSW(0);
+				// A borrow out of the most significant word wraps around (all of the upper words are set)
+				this->updateMSW(borrow ? this->wordCount - 1 : this->MSW);
+				return *this;
 			}
 
 			// Many thanks to the author of http://kt8216.unixcab.org/karatsuba/index.html
@@ -549,45 +1317,25 @@ namespace largeNumberLibrary {
 			// Multiplication done by Karatsuba's algorithm
 			// Design changes and decisions heavily influenced by http://kt8216.unixcab.org/karatsuba/index.html
 			int_limited& operator*= (int_limited const& rhs) {
-				int_limited A, B;
-				if (this->MSW < rhs.MSW) {
-					A = rhs;
-					B = *this;
-				} else {
-					A = *this;
-					B = rhs;
-				}
-				if (B.MSW <= 16) {
-					return this->basicMult(A, B);
-				}
-				int maxWordAmount = A.MSW;
-				int splitWordIndex  = maxWordAmount / 2 + 1;
-				int_limited lowA;
-				lowA.importBits(A.exportBits(), 0, splitWordIndex);
-				int_limited highA;
-				highA.importBits(A.exportBits(), splitWordIndex, maxWordAmount + 1);
-
-				if (splitWordIndex >= B.MSW) {
-					*this = ((highA * B) << (32*splitWordIndex)) + (lowA * B);
-					return *this;
+				// Negative values are multiplied through their magnitude, so that small negative values
+				// keep the benefit of the MSW and LSW optimization (all of their words are set otherwise)
+				// The magnitudes are unsigned, so the algorithm itself never checks for signs again
+				// Values with only one or two words are always multiplied directly, since the negation would cost more
+				if constexpr (isSigned && wordCount > 2) {
+					bool thisNegative = this->isNegative();
+					bool rhsNegative = rhs.isNegative();
+					if (thisNegative || rhsNegative) {
+						int_limited<bitSize, false> product = *this;
+						int_limited<bitSize, false> multiplier = rhs;
+						if (thisNegative) product.negate();
+						if (rhsNegative) multiplier.negate();
+						product *= multiplier;
+						*this = product;
+						if (thisNegative != rhsNegative) this->negate();
+						return *this;
+					}
 				}
-
-				int_limited lowB;
-				lowB.importBits(B.exportBits(), 0, splitWordIndex);
-				int_limited highB;
-				highB.importBits(B.exportBits(), splitWordIndex, maxWordAmount + 1);
-
-				int_limited z0 = lowA * lowB;
-				int_limited z2 = highA * highB;
-				int_limited z1 = (lowA + highA) * (highB + lowB) - z0 - z2;
-
-				*this = z2;
-				*this <<= 32*splitWordIndex;
-				*this += z1;
-				*this <<= 32*splitWordIndex;
-				*this += z0;
-				this->updateLSW(A.LSW);
-				this->updateMSW(A.MSW + B.MSW + 1);
+				*this = multiply(this->view(), rhs.view());
 				return *this;
 			}
 			int_limited operator* (int_limited const& rhs) const {
@@ -595,6 +1343,49 @@ namespace largeNumberLibrary {
 				return result *= rhs;
 			}
 
+			// Multiplies two views as unsigned values (the product is truncated to the bit size)
+			// The halves of the split are only views into the operands, so nothing is copied until they are added together
+			static int_limited multiply(int_limited_view A, int_limited_view B) {
+				A = A.trimmed();
+				B = B.trimmed();
+				if (A.size() < B.size()) std::swap(A, B);
+				int_limited result;
+				if (B.size() <= 17) {
+					return result.basicMult(A, B);
+				}
+				int maxWordAmount = int(A.size()) - 1;
+				int splitWordIndex  = maxWordAmount / 2 + 1;
+				int_limited_view lowA = A.slice(0, splitWordIndex);
+				int_limited_view highA = A.slice(splitWordIndex);
+
+				if (splitWordIndex >= int(B.size()) - 1) {
+					result = multiply(highA, B);
+					result <<= 32*splitWordIndex;
+					result += multiply(lowA, B);
+					return result;
+				}
+
+				int_limited_view lowB = B.slice(0, splitWordIndex);
+				int_limited_view highB = B.slice(splitWordIndex);
+
+				int_limited z0 = multiply(lowA, lowB);
+				int_limited z2 = multiply(highA, highB);
+				int_limited sumA(lowA);
+				sumA += highA;
+				int_limited sumB(lowB);
+				sumB += highB;
+				int_limited z1 = multiply(sumA.view(), sumB.view());
+				z1 -= z0;
+				z1 -= z2;
+
+				result = z2;
+				result <<= 32*splitWordIndex;
+				result += z1;
+				result <<= 32*splitWordIndex;
+				result += z0;
+				return result;
+			}
+
 
 			// Considering the implementation of bitshifting, negation and addition with MSW, LSW
 			// This division should have a complexity of O(bitSize + (rhs.MSW - rhs.LSW)^2)
@@ -602,23 +1393,29 @@ namespace largeNumberLibrary {
 				if (rhs == 0) throw std::domain_error("Divide by zero exception");
 
 				// Create the dividend and divisor with at least an extra word of accuracy for indexing in the algorithm
+				// The extended values are always non-negative, so they are unsigned to skip sign checks
 				const int extraPrecision = 32 + 32-bitSize%32;
-				int_limited<bitSize + extraPrecision> dividend;
-				int_limited<bitSize + extraPrecision> divisor;
-				dividend.importBits(this->exportBits());
-				divisor.importBits(rhs.exportBits());
-				
-				// Convert both of the *original* values to positive
+				int_limited<bitSize + extraPrecision, false> dividend;
+				int_limited<bitSize + extraPrecision, false> divisor;
+
+				// Convert both of the *original* values to their (unsigned) magnitude
+				// Only the used words of the magnitude are then imported into the extended precision
 				// We don't need to worry about the asymmetry of two's complement integer limits
-				// because of the extra precision
+				// because the magnitudes are unsigned
 				bool negative = false;
-				if (*this < 0) {
-					dividend = ((~dividend + 1) << extraPrecision) >> extraPrecision;
-					negative = !negative;
-				}
-				if (rhs < 0) {
-					divisor = ((~divisor + 1) << extraPrecision) >> extraPrecision;
-					negative = !negative;
+				{
+					int_limited<bitSize, false> magnitude = *this;
+					if (this->isNegative()) {
+						magnitude.negate();
+						negative = !negative;
+					}
+					dividend.importBits(std::span<const uint32_t>(magnitude.words.data(), magnitude.MSW + 1));
+					magnitude = rhs;
+					if (rhs.isNegative()) {
+						magnitude.negate();
+						negative = !negative;
+					}
+					divisor.importBits(std::span<const uint32_t>(magnitude.words.data(), magnitude.MSW + 1));
 				}
 
 				*this = 0;
@@ -641,7 +1438,7 @@ namespace largeNumberLibrary {
 					}
 					this->updateLSW(potentialLSW);
 					this->updateMSW(potentialMSW);
-					if (negative) *this = ~(*this) + 1;
+					if (negative) this->negate();
 					return *this;
 				}
 				// This is an implementation of the division algorithm described
@@ -693,16 +1490,17 @@ namespace largeNumberLibrary {
 							rem += divisor.words[vInd];
 						}
 					}
-					int_limited<bitSize + extraPrecision> diff = divisor * qEst;
-
-					// Subtract diff manually, since the values have the same precision, but are offset
+					// Subtract divisor * qEst manually, since the values are offset
+					// The product is calculated word by word, so no temporary value of the whole precision is required
 					// Also because we aren't supposed to propagate the borrow all the way to the left
+					uint64_t mulCarry = 0;
 					bool borrow = false;
-					for (int curInd = diff.LSW; curInd <= vInd + 1; curInd++) {
-						bool flag1 = diff.words[curInd] > dividend.words[j + curInd];
-						bool flag2 = (diff.words[curInd] == dividend.words[j + curInd]) && borrow;
-						dividend.words[j + curInd] -= diff.words[curInd] + borrow;
-						borrow = flag1 || flag2;
+					for (int curInd = divisor.LSW; curInd <= vInd + 1; curInd++) {
+						uint64_t product = qEst * divisor.words[curInd] + mulCarry;
+						mulCarry = product >> 32;
+						uint64_t difference = uint64_t(dividend.words[j + curInd]) - uint32_t(product) - borrow;
+						dividend.words[j + curInd] = uint32_t(difference);
+						borrow = difference >> 63;
 					}
 					this->words[j] = uint32_t(qEst);
 
@@ -724,7 +1522,7 @@ namespace largeNumberLibrary {
 
 				this->updateLSW(potentialLSW);
 				this->updateMSW(potentialMSW);
-				if (negative) *this = ~(*this) + 1;
+				if (negative) this->negate();
 				return *this;
 			}
 			int_limited operator/ (int_limited const& rhs) const {
@@ -737,21 +1535,27 @@ namespace largeNumberLibrary {
 				if (rhs == 0) throw std::domain_error("Modulo by zero exception");
 				
 				// Create the dividend and divisor with at least an extra word of accuracy for indexing in the algorithm
+				// The extended values are always non-negative, so they are unsigned to skip sign checks
 				const int extraPrecision = 64 + 32-bitSize%32;
-				int_limited<bitSize + extraPrecision> dividend;
-				int_limited<bitSize + extraPrecision> divisor;
-				dividend.importBits(this->exportBits());
-				divisor.importBits(rhs.exportBits());
-				
-				// Convert both of the *original* values to positive
+				int_limited<bitSize + extraPrecision, false> dividend;
+				int_limited<bitSize + extraPrecision, false> divisor;
+
+				// Convert both of the *original* values to their (unsigned) magnitude
+				// Only the used words of the magnitude are then imported into the extended precision
 				// We don't need to worry about the asymmetry of two's complement integer limits
-				// because of the extra precision
+				// because the magnitudes are unsigned
 				bool negative = false;
-				if (*this < 0) {
-					dividend = ((~dividend + 1) << extraPrecision) >> extraPrecision;
-					negative = !negative;
+				{
+					int_limited<bitSize, false> magnitude = *this;
+					if (this->isNegative()) {
+						magnitude.negate();
+						negative = true;
+					}
+					dividend.importBits(std::span<const uint32_t>(magnitude.words.data(), magnitude.MSW + 1));
+					magnitude = rhs;
+					if (rhs.isNegative()) magnitude.negate();
+					divisor.importBits(std::span<const uint32_t>(magnitude.words.data(), magnitude.MSW + 1));
 				}
-				if (rhs < 0) divisor = ((~divisor + 1) << extraPrecision) >> extraPrecision;
 
 				if (divisor > dividend) {
 					// no need to change the sign, because we didn't change (*this) yet
@@ -773,7 +1577,7 @@ namespace largeNumberLibrary {
 					this->words[0] = curWord % divWord;
 					this->updateLSW(potentialLSW);
 					this->updateMSW(potentialMSW);
-					if (negative) *this = ~(*this) + 1;
+					if (negative) this->negate();
 					return *this;
 				}
 				// This is an implementation of the division algorithm described
@@ -824,16 +1628,17 @@ namespace largeNumberLibrary {
 							rem += divisor.words[vInd];
 						}
 					}
-					int_limited<bitSize + extraPrecision> diff = divisor * qEst;
-
-					// Subtract diff manually, since the values have the same precision, but are offset
+					// Subtract divisor * qEst manually, since the values are offset
+					// The product is calculated word by word, so no temporary value of the whole precision is required
 					// Also because we aren't supposed to propagate the borrow all the way to the left
+					uint64_t mulCarry = 0;
 					bool borrow = false;
-					for (int curInd = diff.LSW; curInd <= vInd + 1; curInd++) {
-						bool flag1 = diff.words[curInd] > dividend.words[j + curInd];
-						bool flag2 = (diff.words[curInd] == dividend.words[j + curInd]) && borrow;
-						dividend.words[j + curInd] -= diff.words[curInd] + borrow;
-						borrow = flag1 || flag2;
+					for (int curInd = divisor.LSW; curInd <= vInd + 1; curInd++) {
+						uint64_t product = qEst * divisor.words[curInd] + mulCarry;
+						mulCarry = product >> 32;
+						uint64_t difference = uint64_t(dividend.words[j + curInd]) - uint32_t(product) - borrow;
+						dividend.words[j + curInd] = uint32_t(difference);
+						borrow = difference >> 63;
 					}
 
 					// If the result is negative, add the divisor back once
@@ -859,7 +1664,7 @@ namespace largeNumberLibrary {
 				}
 				this->updateLSW(potentialLSW);
 				this->updateMSW(potentialMSW);
-				if (negative) *this = ~(*this) + 1;
+				if (negative) this->negate();
 				return *this;
 			}
 			int_limited operator% (int_limited const& rhs) const {
@@ -929,6 +1734,7 @@ namespace largeNumberLibrary {
 				for (int i = 0; i < this->wordCount; i++) {
 					result.words[i] = ~this->words[i];
 				}
+				result.truncateExtraBits();
 				result.updateLSW(0);
 				result.updateMSW(this->wordCount-1);
 				return result;
@@ -944,6 +1750,7 @@ namespace largeNumberLibrary {
 					this->wordShiftLeft(i, wordshift);
 					this->bitShiftLeft(i + wordshift, bitshift);
 				}
+				this->truncateExtraBits();
 				this->updateLSW(this->LSW + wordshift - 1);
 				this->updateMSW(this->MSW + wordshift + 1);
 				return *this;
@@ -985,6 +1792,9 @@ namespace largeNumberLibrary {
 			< (less-than) DONE
 			>= (greater-than-or-equal-to) DONE
 			<= (less-than-or-equal-to) DONE
+			<=> (three-way comparison) DONE
+			compareAbs DONE
+			hash DONE
 			=============================================================
 			*/
 			#pragma region Relational
@@ -1001,43 +1811,54 @@ namespace largeNumberLibrary {
 			bool operator!= (int_limited const& rhs) const {
 				return !(*this == rhs);
 			}
-			bool operator> (int_limited const& rhs) const {
-				uint32_t MSb = BIT32_ON;
-				if (bitSize%32 != 0) {
-					MSb >>= 32 - (bitSize%32);
-				}
-				// if different signs, then false if *this is negative, true if rhs is negative
-				if ((this->words[this->wordCount-1] & MSb) != (rhs.words[rhs.wordCount-1] & MSb)) return this->words[wordCount-1] < rhs.words[rhs.wordCount-1];
-				// Both signs are the same, so simply compare each value
-				if (this->MSW != rhs.MSW) return this->MSW > rhs.MSW;
-				for (int i = this->MSW; i >= this->LSW; i--) {
-					if (this->words[i] != rhs.words[i]) return this->words[i] > rhs.words[i];
+			// A single scan from the top word, which stops at the first differing word
+			std::strong_ordering operator<=> (int_limited const& rhs) const {
+				if constexpr (isSigned) {
+					// if different signs, then the negative value is smaller
+					bool thisNegative = this->isNegative();
+					if (thisNegative != rhs.isNegative()) return thisNegative ? std::strong_ordering::less : std::strong_ordering::greater;
 				}
-				// if they have been equal up to here then they are either equal or rhs.LSW < this->LSW (*this < rhs)
-				return false;
+				// Both signs are the same, so the words can be compared as unsigned values
+				if (this->MSW != rhs.MSW) return this->MSW <=> rhs.MSW;
+				for (int i = this->MSW; i >= std::min(this->LSW, rhs.LSW); i--) {
+					if (this->words[i] != rhs.words[i]) return this->words[i] <=> rhs.words[i];
+				}
+				return std::strong_ordering::equal;
+			}
+			bool operator> (int_limited const& rhs) const {
+				return (*this <=> rhs) > 0;
 			}
 			bool operator< (int_limited const& rhs) const {
-				uint32_t MSb = BIT32_ON;
-				if (bitSize%32 != 0) {
-					MSb >>= 32 - (bitSize%32);
-				}
-				// if different signs, then false if *this is negative, true if rhs is negative
-				if ((this->words[this->wordCount-1] & MSb) != (rhs.words[rhs.wordCount-1] & MSb)) return this->words[wordCount-1] > rhs.words[rhs.wordCount-1];
-				
-				// Both signs are the same, so simply compare each value
-				if (this->MSW != rhs.MSW) return this->MSW < rhs.MSW;
-
-				for (int i = this->MSW; i >= this->LSW; i--) {
-					if (this->words[i] != rhs.words[i]) return this->words[i] < rhs.words[i];
-				}
-				// if they have been equal up to here then they are either equal or rhs.LSW < this->LSW (*this < rhs)
-				return rhs.LSW < this->LSW;
+				return (*this <=> rhs) < 0;
 			}
 			bool operator>= (int_limited const& rhs) const {
-				return !(*this < rhs);
+				return (*this <=> rhs) >= 0;
 			}
 			bool operator<= (int_limited const& rhs) const {
-				return !(*this > rhs);
+				return (*this <=> rhs) <= 0;
+			}
+
+			// Compares the absolute values, i.e. |*this| <=> |rhs|
+			// The magnitudes are compared as unsigned values, so MIN_VALUE is the largest magnitude
+			std::strong_ordering compareAbs(int_limited const& rhs) const {
+				if (!this->isNegative() && !rhs.isNegative()) return *this <=> rhs;
+				int_limited<bitSize, false> A = *this;
+				int_limited<bitSize, false> B = rhs;
+				if (this->isNegative()) A.negate();
+				if (rhs.isNegative()) B.negate();
+				return A <=> B;
+			}
+
+			// Hashes the used words 64 bits at a time with the wyhash mixing function
+			// Equal values always have the same words and MSW, so they always have the same hash
+			std::size_t hash() const {
+				uint64_t seed = HASH_SECRET_0 ^ uint64_t(this->MSW);
+				for (int i = this->LSW & ~1; i <= this->MSW; i += 2) {
+					uint64_t chunk = this->words[i];
+					if (i + 1 <= this->MSW) chunk |= uint64_t(this->words[i + 1]) << 32;
+					seed = hashMix(chunk ^ HASH_SECRET_1, seed ^ HASH_SECRET_0);
+				}
+				return std::size_t(hashMix(seed ^ HASH_SECRET_1, uint64_t(this->LSW) ^ HASH_SECRET_0));
 			}
 			#pragma endregion Relational
 
@@ -1080,7 +1901,7 @@ namespace largeNumberLibrary {
 			#pragma region Math
 			// returns a signed integer of the floored binary log
 			int ilog2() const {
-				if (*this <= 0) throw std::domain_error("Logarithm of non-positive exception");
+				if (!*this || (isSigned && *this < 0)) throw std::domain_error("Logarithm of non-positive exception");
 				int result = this->MSW * 32;
 				
 				int leadingZeroes = 32;
@@ -1111,7 +1932,7 @@ namespace largeNumberLibrary {
 
 			// returns the floored value of integer square root
 			int_limited isqrt() const {
-				if (*this < 0) throw std::domain_error("Sqrt of negative value exception");
+				if (isSigned && *this < 0) throw std::domain_error("Sqrt of negative value exception");
 				if (this->MSW == 0 && this->words[0] < 4) return (this->words[0] > 0);
 				int sigBits = this->ilog2();
 				int_limited low = (*this >> (sigBits/2 + 1));
@@ -1128,4 +1949,17 @@ namespace largeNumberLibrary {
 
 			#pragma endregion Math
 	};
-}
\ No newline at end of file
+
+	// Unsigned companion of int_limited with modular (wraparound) semantics
+	// Converting to and from an int_limited of the same size only copies the words
+	template <int bitSize>
+	using uint_limited = int_limited<bitSize, false>;
+}
+
+// Allows int_limited to be used in unordered containers
+template <int bitSize, bool isSigned>
+struct std::hash<largeNumberLibrary::int_limited<bitSize, isSigned>> {
+	std::size_t operator() (largeNumberLibrary::int_limited<bitSize, isSigned> const& value) const {
+		return value.hash();
+	}
+};
\ No newline at end of file
@@ -0,0 +1,729 @@
+#pragma once
+#include "int_limited.hpp"
+#include "uint128.hpp"
+#include <cstdint>
+#include <algorithm>
+#include <ostream>
+#include <array>
+#include <bit>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+// Modular arithmetic with a fixed modulus, without dividing by it for every reduction
+namespace largeNumberLibrary {
+	// Arithmetic on arrays of 64 bit limbs (least significant limb first), shared by the contexts and mod_int
+	// Everything is constexpr, so that the constants of a modulus can be computed at compile time
+	namespace limbArithmetic {
+		template <std::size_t size>
+		constexpr bool lessThan(std::array<uint64_t, size> const& a, std::array<uint64_t, size> const& b) noexcept {
+			for (int i = int(size) - 1; i >= 0; i--) {
+				if (a[i] != b[i]) return a[i] < b[i];
+			}
+			return false;
+		}
+
+		// a += b, returns the carry out of the most significant limb
+		template <std::size_t size>
+		constexpr uint64_t add(std::array<uint64_t, size>& a, std::array<uint64_t, size> const& b) noexcept {
+			uint64_t carry = 0;
+			for (std::size_t i = 0; i < size; i++) {
+				uint64_t sum = a[i] + b[i] + carry;
+				carry = (sum < a[i]) || (sum == a[i] && carry);
+				a[i] = sum;
+			}
+			return carry;
+		}
+
+		// a -= b, returns the borrow out of the most significant limb (the result is modulo 2^(64*size))
+		template <std::size_t size>
+		constexpr uint64_t subtract(std::array<uint64_t, size>& a, std::array<uint64_t, size> const& b) noexcept {
+			uint64_t borrow = 0;
+			for (std::size_t i = 0; i < size; i++) {
+				uint64_t difference = a[i] - b[i] - borrow;
+				borrow = (a[i] < b[i]) || (a[i] - b[i] < borrow);
+				a[i] = difference;
+			}
+			return borrow;
+		}
+
+		// Returns the full product of a and b
+		template <std::size_t size>
+		constexpr std::array<uint64_t, 2*size> multiply(std::array<uint64_t, size> const& a, std::array<uint64_t, size> const& b) noexcept {
+			std::array<uint64_t, 2*size> result = {};
+			for (std::size_t i = 0; i < size; i++) {
+				uint64_t carry = 0;
+				for (std::size_t j = 0; j < size; j++) {
+					uint128 product = uint128(a[j]) * uint128(b[i]) + uint128(result[i + j]) + uint128(carry);
+					result[i + j] = uint64_t(product);
+					carry = uint64_t(product >> 64);
+				}
+				result[i + size] = carry;
+			}
+			return result;
+		}
+
+		// Returns the amount of bits used by the value (0 for zero)
+		template <std::size_t size>
+		constexpr int bitLength(std::array<uint64_t, size> const& value) noexcept {
+			for (int i = int(size) - 1; i >= 0; i--) {
+				if (value[i] != 0) return 64*i + std::bit_width(value[i]);
+			}
+			return 0;
+		}
+
+		// Parses a non-negative decimal or hexadecimal (with the prefix "0x") value at compile time
+		// Throws std::domain_error for an invalid digit and std::overflow_error if the value doesn't fit into bitSize bits
+		template <int bitSize>
+		constexpr std::array<uint64_t, (bitSize + 63) / 64> parse(std::string_view digits) {
+			std::array<uint64_t, (bitSize + 63) / 64> value = {};
+			uint64_t base = 10;
+			if (digits.size() > 2 && digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X')) {
+				base = 16;
+				digits.remove_prefix(2);
+			}
+			if (digits.empty()) throw std::domain_error("Missing digits");
+			for (char digit : digits) {
+				uint64_t digitValue = 0;
+				if (digit >= '0' && digit <= '9') digitValue = digit - '0';
+				else if (base == 16 && digit >= 'a' && digit <= 'f') digitValue = digit - 'a' + 10;
+				else if (base == 16 && digit >= 'A' && digit <= 'F') digitValue = digit - 'A' + 10;
+				else if (digit == '\'') continue;
+				else throw std::domain_error("Invalid digit");
+
+				uint64_t carry = digitValue;
+				for (uint64_t& limb : value) {
+					uint128 product = uint128(limb) * uint128(base) + uint128(carry);
+					limb = uint64_t(product);
+					carry = uint64_t(product >> 64);
+				}
+				if (carry != 0 || bitLength(value) > bitSize) throw std::overflow_error("Value doesn't fit into the bit size");
+			}
+			return value;
+		}
+	}
+
+	// Montgomery multiplication modulo a fixed odd modulus N
+	// Values are kept in the Montgomery form x*R mod N (where R = 2^(64*limbCount))
+	// The product of two such values is reduced by adding a multiple of N, which makes the lowest limbs zero,
+	// and shifting them out (instead of dividing by N)
+	//
+	// All arithmetic is done on arrays of 64 bit limbs (least significant limb first), with 128 bit products
+	// The limb overloads are constexpr, so that a context (and any values) can be computed at compile time
+	// The uint_limited overloads only convert the values into limbs and back
+	//
+	// SECTION Construction
+	// 	from limbs (constexpr) DONE
+	// 	from uint_limited DONE
+	// 	throws std::domain_error for an even modulus or a modulus smaller than 3 DONE
+	//	the constants are computed without any division DONE
+	// SECTION Conversion
+	// 	toMont, fromMont DONE
+	// 	toLimbs, fromLimbs DONE
+	// SECTION Arithmetic (in the Montgomery form)
+	// 	mul (CIOS) DONE
+	// 	sqr DONE
+	// 	pow DONE
+	// 	powMod (converts the base into the Montgomery form and the result back) DONE
+	template <int bitSize>
+	class MontgomeryContext {
+		public:
+			static constexpr int limbCount = (bitSize + 63) / 64;
+			typedef std::array<uint64_t, limbCount> limbArray;
+
+		private:
+			limbArray modulusLimbs;
+			// -N^(-1) mod 2^64
+			uint64_t nPrime;
+			// R mod N (the Montgomery form of 1)
+			limbArray rModN;
+			// R^2 mod N (multiplying by it converts a value into the Montgomery form)
+			limbArray r2ModN;
+
+			// value = 2*value mod N, for value < N
+			constexpr void doubleMod(limbArray& value) const noexcept {
+				uint64_t carry = limbArithmetic::add(value, value);
+				// If the doubled value overflowed, subtracting N wraps it back below N
+				if (carry || !limbArithmetic::lessThan(value, modulusLimbs)) limbArithmetic::subtract(value, modulusLimbs);
+			}
+
+		public:
+			#pragma region Construction
+			constexpr explicit MontgomeryContext(limbArray const& modulus) : modulusLimbs(modulus), nPrime(0), rModN{}, r2ModN{} {
+				bool isSmall = modulus[0] < 3;
+				for (int i = 1; i < limbCount; i++) if (modulus[i] != 0) isSmall = false;
+				if ((modulus[0] & 1) == 0 || isSmall) throw std::domain_error("Montgomery modulus has to be odd and larger than 1");
+
+				// Newton's iteration doubles the amount of correct bits of the inverse (N*N = 1 mod 8 for any odd N)
+				uint64_t inverse = modulus[0];
+				for (int i = 0; i < 5; i++) inverse *= 2 - modulus[0] * inverse;
+				nPrime = 0 - inverse;
+
+				// 2^(64*limbCount) mod N and 2^(128*limbCount) mod N by doubling 1
+				rModN[0] = 1;
+				for (int i = 0; i < 64*limbCount; i++) doubleMod(rModN);
+				r2ModN = rModN;
+				for (int i = 0; i < 64*limbCount; i++) doubleMod(r2ModN);
+			}
+
+			explicit MontgomeryContext(uint_limited<bitSize> const& modulus) : MontgomeryContext(toLimbs(modulus)) {}
+			#pragma endregion Construction
+
+			#pragma region Conversion
+			static limbArray toLimbs(uint_limited<bitSize> const& value) {
+				limbArray limbs;
+				value.exportBits(std::span<uint64_t>(limbs));
+				return limbs;
+			}
+
+			static uint_limited<bitSize> fromLimbs(limbArray const& limbs) {
+				uint_limited<bitSize> value;
+				value.importBits(std::span<const uint64_t>(limbs));
+				return value;
+			}
+
+			constexpr limbArray const& modulus() const noexcept {
+				return modulusLimbs;
+			}
+
+			// The Montgomery form of 1
+			constexpr limbArray const& one() const noexcept {
+				return rModN;
+			}
+
+			// Expects value < N
+			constexpr limbArray toMont(limbArray const& value) const noexcept {
+				return mul(value, r2ModN);
+			}
+
+			// Values larger than N are reduced first (which is the only division)
+			uint_limited<bitSize> toMont(uint_limited<bitSize> value) const {
+				uint_limited<bitSize> modulusValue = fromLimbs(modulusLimbs);
+				if (value >= modulusValue) value %= modulusValue;
+				return fromLimbs(toMont(toLimbs(value)));
+			}
+
+			// Multiplying by 1 (instead of R^2) removes the factor R
+			constexpr limbArray fromMont(limbArray const& value) const noexcept {
+				limbArray unit = {1};
+				return mul(value, unit);
+			}
+
+			uint_limited<bitSize> fromMont(uint_limited<bitSize> const& value) const {
+				return fromLimbs(fromMont(toLimbs(value)));
+			}
+			#pragma endregion Conversion
+
+			#pragma region Arithmetic
+			// Returns a*b*R^(-1) mod N, for a, b < N
+			// Coarsely Integrated Operand Scanning (CIOS): each row of the product is reduced right after it is added,
+			// so the intermediate value never has more than limbCount + 2 limbs
+			constexpr limbArray mul(limbArray const& a, limbArray const& b) const noexcept {
+				std::array<uint64_t, limbCount + 2> t = {};
+				for (int i = 0; i < limbCount; i++) {
+					// (2^64 - 1)^2 + 2*(2^64 - 1) = 2^128 - 1, so none of the sums overflow
+					uint64_t carry = 0;
+					for (int j = 0; j < limbCount; j++) {
+						uint128 product = uint128(a[j]) * uint128(b[i]) + uint128(t[j]) + uint128(carry);
+						t[j] = uint64_t(product);
+						carry = uint64_t(product >> 64);
+					}
+					uint128 sum = uint128(t[limbCount]) + uint128(carry);
+					t[limbCount] = uint64_t(sum);
+					t[limbCount + 1] = uint64_t(sum >> 64);
+
+					// m is chosen so that t + m*N is divisible by 2^64, the division is then a shift by one limb
+					uint64_t m = t[0] * nPrime;
+					uint128 product = uint128(m) * uint128(modulusLimbs[0]) + uint128(t[0]);
+					carry = uint64_t(product >> 64);
+					for (int j = 1; j < limbCount; j++) {
+						product = uint128(m) * uint128(modulusLimbs[j]) + uint128(t[j]) + uint128(carry);
+						t[j - 1] = uint64_t(product);
+						carry = uint64_t(product >> 64);
+					}
+					sum = uint128(t[limbCount]) + uint128(carry);
+					t[limbCount - 1] = uint64_t(sum);
+					t[limbCount] = t[limbCount + 1] + uint64_t(sum >> 64);
+				}
+				// t < 2N, so a single subtraction is enough
+				limbArray result;
+				for (int i = 0; i < limbCount; i++) result[i] = t[i];
+				if (t[limbCount] != 0 || !limbArithmetic::lessThan(result, modulusLimbs)) limbArithmetic::subtract(result, modulusLimbs);
+				return result;
+			}
+
+			uint_limited<bitSize> mul(uint_limited<bitSize> const& a, uint_limited<bitSize> const& b) const {
+				return fromLimbs(mul(toLimbs(a), toLimbs(b)));
+			}
+
+			// Currently the same as mul(a, a)
+			constexpr limbArray sqr(limbArray const& a) const noexcept {
+				return mul(a, a);
+			}
+
+			uint_limited<bitSize> sqr(uint_limited<bitSize> const& a) const {
+				return fromLimbs(sqr(toLimbs(a)));
+			}
+
+			// Returns base^exp in the Montgomery form (for base in the Montgomery form)
+			// The exponent is given as limbs of any length (least significant limb first)
+			// Left to right binary exponentiation (one squaring for every bit, one multiplication for every set bit)
+			constexpr limbArray pow(limbArray const& base, std::span<const uint64_t> exp) const noexcept {
+				limbArray result = rModN;
+				for (int i = int(exp.size())*64 - 1; i >= 0; i--) {
+					result = sqr(result);
+					if ((exp[i / 64] >> (i % 64)) & 1) result = mul(result, base);
+				}
+				return result;
+			}
+
+			template <int expBitSize>
+			uint_limited<bitSize> pow(uint_limited<bitSize> const& base, uint_limited<expBitSize> const& exp) const {
+				std::array<uint64_t, (expBitSize + 63) / 64> expLimbs;
+				std::span<uint64_t> expSpan(expLimbs);
+				// Leading zero limbs would only square the Montgomery form of 1
+				expSpan = expSpan.first(exp.exportBits(expSpan));
+				while (!expSpan.empty() && expSpan.back() == 0) expSpan = expSpan.first(expSpan.size() - 1);
+				return fromLimbs(pow(toLimbs(base), expSpan));
+			}
+
+			uint_limited<bitSize> pow(uint_limited<bitSize> const& base, uint64_t exp) const {
+				return pow(base, uint_limited<64>(exp));
+			}
+
+			// Returns base^exp mod N (base and the result aren't in the Montgomery form)
+			template <int expBitSize>
+			uint_limited<bitSize> powMod(uint_limited<bitSize> const& base, uint_limited<expBitSize> const& exp) const {
+				return fromMont(pow(toMont(base), exp));
+			}
+
+			uint_limited<bitSize> powMod(uint_limited<bitSize> const& base, uint64_t exp) const {
+				return fromMont(pow(toMont(base), exp));
+			}
+			#pragma endregion Arithmetic
+	};
+
+	// Barrett reduction modulo a fixed modulus N (which can be even)
+	// With n as the amount of 64 bit limbs of N and k = 64*n, mu = floor(4^k / N) is computed once (with a single division)
+	// Afterwards any value smaller than 4^k (e.g. the product of two values smaller than N) is reduced
+	// with two multiplications and at most two subtractions
+	// Unlike MontgomeryContext, the values don't have to be converted into any other form
+	//
+	// The reduction works on 64 bit limbs (least significant limb first) with 128 bit products, the same as MontgomeryContext
+	//
+	// SECTION Construction
+	// 	from uint_limited DONE
+	// 	throws std::domain_error for a zero modulus DONE
+	// SECTION Reduction
+	// 	reduce (of a double width value) DONE
+	// 	mulMod, sqrMod DONE
+	// 	operator% and operator%= with the context DONE
+	template <int bitSize>
+	class BarrettContext {
+		public:
+			static constexpr int limbCount = (bitSize + 63) / 64;
+			typedef std::array<uint64_t, limbCount> limbArray;
+			typedef std::array<uint64_t, 2*limbCount> doubleLimbArray;
+			typedef uint_limited<bitSize> valueType;
+			// Large enough for the product of any two values
+			typedef uint_limited<2*bitSize> doubleType;
+
+		private:
+			limbArray modulusLimbs;
+			// The amount of limbs of the modulus without the most significant zero limbs
+			int n;
+			// mu < 2^(64*(n + 1)), except for N = 2^(64*(n - 1)), where it is exactly 2^(64*(n + 1))
+			std::array<uint64_t, limbCount + 2> mu;
+			int muSize;
+
+			// result = a*b, where result has at least a.size() + b.size() limbs
+			static void multiplyLimbs(std::span<const uint64_t> a, std::span<const uint64_t> b, std::span<uint64_t> result) noexcept {
+				std::fill(result.begin(), result.begin() + a.size() + b.size(), 0);
+				for (std::size_t i = 0; i < b.size(); i++) {
+					if (b[i] == 0) continue;
+					uint64_t carry = 0;
+					for (std::size_t j = 0; j < a.size(); j++) {
+						uint128 product = uint128(a[j]) * uint128(b[i]) + uint128(result[i + j]) + uint128(carry);
+						result[i + j] = uint64_t(product);
+						carry = uint64_t(product >> 64);
+					}
+					result[i + a.size()] = carry;
+				}
+			}
+
+		public:
+			#pragma region Construction
+			explicit BarrettContext(valueType const& modulus) : modulusLimbs(toLimbs(modulus)), mu{} {
+				if (modulus == 0) throw std::domain_error("Barrett modulus can't be zero");
+				n = limbCount;
+				while (modulusLimbs[n - 1] == 0) n--;
+
+				uint_limited<64*(2*limbCount + 2)> power = 1;
+				power <<= 128*n;
+				power /= uint_limited<64*(2*limbCount + 2)>(modulus);
+				power.exportBits(std::span<uint64_t>(mu));
+				muSize = limbCount + 2;
+				while (mu[muSize - 1] == 0) muSize--;
+			}
+			#pragma endregion Construction
+
+			#pragma region Conversion
+			static limbArray toLimbs(valueType const& value) {
+				limbArray limbs;
+				value.exportBits(std::span<uint64_t>(limbs));
+				return limbs;
+			}
+
+			static valueType fromLimbs(limbArray const& limbs) {
+				valueType value;
+				value.importBits(std::span<const uint64_t>(limbs));
+				return value;
+			}
+
+			valueType modulus() const {
+				return fromLimbs(modulusLimbs);
+			}
+			#pragma endregion Conversion
+
+			#pragma region Reduction
+			// Returns value mod N
+			// Values with more than 2n limbs (only possible for a modulus with less limbs than limbCount) are reduced with % instead
+			limbArray reduce(doubleLimbArray const& value) const {
+				int valueSize = 2*limbCount;
+				while (valueSize > 0 && value[valueSize - 1] == 0) valueSize--;
+				if (valueSize > 2*n) {
+					doubleType wide;
+					wide.importBits(std::span<const uint64_t>(value));
+					return toLimbs(valueType(wide % doubleType(modulus())));
+				}
+
+				// q = floor(floor(value / 2^(64*(n - 1))) * mu / 2^(64*(n + 1))), which is at most 2 smaller than floor(value / N)
+				std::array<uint64_t, 2*limbCount + 3> q2 = {};
+				std::span<const uint64_t> q1(value.data() + n - 1, std::max(valueSize - (n - 1), 0));
+				multiplyLimbs(q1, std::span<const uint64_t>(mu.data(), muSize), q2);
+				std::span<const uint64_t> q3(q2.data() + n + 1, std::max(int(q1.size()) + muSize - (n + 1), 0));
+
+				// The remainder is smaller than 3N < 2^(64*(n + 1)), so both value and q*N are only needed modulo 2^(64*(n + 1))
+				std::array<uint64_t, limbCount + 1> remainder = {};
+				for (int i = 0; i <= n && i < 2*limbCount; i++) remainder[i] = value[i];
+				for (std::size_t i = 0; i < q3.size() && int(i) <= n; i++) {
+					if (q3[i] == 0) continue;
+					uint64_t carry = 0;
+					uint64_t borrow = 0;
+					for (int j = 0; int(i) + j <= n; j++) {
+						uint128 product = uint128(j < n ? modulusLimbs[j] : 0) * uint128(q3[i]) + uint128(carry);
+						carry = uint64_t(product >> 64);
+						uint64_t& limb = remainder[i + j];
+						uint64_t subtrahend = uint64_t(product);
+						uint64_t difference = limb - subtrahend - borrow;
+						borrow = (limb < subtrahend) || (limb - subtrahend < borrow);
+						limb = difference;
+					}
+				}
+
+				// At most two subtractions of N
+				while (true) {
+					bool smaller = remainder[n] == 0;
+					if (smaller) {
+						for (int i = n - 1; i >= 0; i--) {
+							if (remainder[i] != modulusLimbs[i]) {
+								smaller = remainder[i] < modulusLimbs[i];
+								break;
+							}
+							if (i == 0) smaller = false;
+						}
+					}
+					if (smaller) break;
+					uint64_t borrow = 0;
+					for (int i = 0; i <= n; i++) {
+						uint64_t subtrahend = i < n ? modulusLimbs[i] : 0;
+						uint64_t difference = remainder[i] - subtrahend - borrow;
+						borrow = (remainder[i] < subtrahend) || (remainder[i] - subtrahend < borrow);
+						remainder[i] = difference;
+					}
+				}
+				limbArray result;
+				for (int i = 0; i < limbCount; i++) result[i] = remainder[i];
+				return result;
+			}
+
+			valueType reduce(doubleType const& value) const {
+				doubleLimbArray limbs;
+				value.exportBits(std::span<uint64_t>(limbs));
+				return fromLimbs(reduce(limbs));
+			}
+
+			valueType reduce(valueType const& value) const {
+				doubleLimbArray limbs = {};
+				value.exportBits(std::span<uint64_t>(limbs).first(limbCount));
+				return fromLimbs(reduce(limbs));
+			}
+
+			// Returns (a*b) mod N, for a, b < N
+			limbArray mulMod(limbArray const& a, limbArray const& b) const {
+				doubleLimbArray product;
+				multiplyLimbs(std::span<const uint64_t>(a), std::span<const uint64_t>(b), product);
+				return reduce(product);
+			}
+
+			valueType mulMod(valueType const& a, valueType const& b) const {
+				return fromLimbs(mulMod(toLimbs(a), toLimbs(b)));
+			}
+
+			valueType sqrMod(valueType const& a) const {
+				return mulMod(a, a);
+			}
+
+			friend valueType operator% (doubleType const& value, BarrettContext const& context) {
+				return context.reduce(value);
+			}
+
+			friend valueType operator% (valueType const& value, BarrettContext const& context) {
+				return context.reduce(value);
+			}
+
+			friend valueType& operator%= (valueType& value, BarrettContext const& context) {
+				value = context.reduce(value);
+				return value;
+			}
+			#pragma endregion Reduction
+	};
+
+	// An integer modulo a compile time constant Modulus (given as limbs, which can be created with limbArithmetic::parse)
+	// Every value is always reduced, all reduction constants are computed by the compiler and all operations are constexpr
+	//
+	// Moduli of the special form 2^k - c (with a small c, e.g. 2^255 - 19 or 2^64 - 59) are reduced by folding
+	// the bits above k back as (high bits)*c, so the value is kept as it is
+	// Any other modulus has to be odd and the value is kept in the Montgomery form (using a constexpr MontgomeryContext)
+	//
+	// SECTION Construction
+	// 	default (zero) DONE
+	// 	from uint64_t (constexpr) DONE
+	// 	from uint_limited DONE
+	// SECTION Conversion
+	// 	limbs (constexpr) DONE
+	// 	value (uint_limited) DONE
+	// 	toString DONE
+	// SECTION Arithmetic
+	// 	+, -, * and compound assignment DONE
+	// 	unary - DONE
+	// 	pow (uint64_t, limbs or uint_limited exponent) DONE
+	// 	inverse (for a prime modulus) DONE
+	// SECTION Comparison
+	// 	==, != DONE
+	template <int bitSize, typename MontgomeryContext<bitSize>::limbArray Modulus>
+	class mod_int {
+		public:
+			static constexpr int limbCount = MontgomeryContext<bitSize>::limbCount;
+			typedef typename MontgomeryContext<bitSize>::limbArray limbArray;
+
+		private:
+			typedef std::array<uint64_t, 2*limbCount> doubleLimbArray;
+
+			// Modulus = 2^k - c
+			static constexpr int k = limbArithmetic::bitLength(Modulus);
+
+			static constexpr limbArray computeC() {
+				// 2^k - Modulus = (2^(64*limbCount) - Modulus) mod 2^k
+				limbArray c = {};
+				limbArithmetic::subtract(c, Modulus);
+				for (int i = 0; i < limbCount; i++) {
+					if (64*i >= k) c[i] = 0;
+					else if (64*(i + 1) > k) c[i] &= UINT64_MAX >> (64*(i + 1) - k);
+				}
+				return c;
+			}
+			static constexpr limbArray c = computeC();
+
+			// c has to be small enough, so that two folds always leave a value smaller than 2*Modulus
+			// (with c < 2^32 and (c + 1)^2 < 2^(k - 1))
+			static constexpr bool computeIsSpecialForm() {
+				if (k < 3 || c[0] >= (uint64_t(1) << 32)) return false;
+				for (int i = 1; i < limbCount; i++) if (c[i] != 0) return false;
+				return k - 1 >= 65 || (uint128(c[0]) + 1) * (uint128(c[0]) + 1) < (uint128(1) << (k - 1));
+			}
+
+		public:
+			static constexpr bool isSpecialForm = computeIsSpecialForm();
+			static_assert(isSpecialForm || (Modulus[0] & 1) == 1, "The modulus of mod_int has to be odd or of the form 2^k - c (with a small c)");
+
+		private:
+			struct noContext {};
+			static constexpr auto createContext() {
+				if constexpr (isSpecialForm) return noContext{};
+				else return MontgomeryContext<bitSize>(Modulus);
+			}
+			static constexpr auto context = createContext();
+
+			// The value (for special forms) or the Montgomery form of the value
+			limbArray representation;
+
+			// Returns value mod Modulus for any double width value (only used for special forms)
+			static constexpr limbArray fold(doubleLimbArray value) noexcept {
+				while (limbArithmetic::bitLength(value) > k) {
+					// value = low + high*2^k = low + high*c (mod Modulus)
+					doubleLimbArray high = {};
+					int wordShift = k / 64;
+					int bitShift = k % 64;
+					for (int i = 0; i + wordShift < 2*limbCount; i++) {
+						high[i] = value[i + wordShift] >> bitShift;
+						if (bitShift != 0 && i + wordShift + 1 < 2*limbCount) high[i] |= value[i + wordShift + 1] << (64 - bitShift);
+					}
+					for (int i = 0; i < 2*limbCount; i++) {
+						if (64*i >= k) value[i] = 0;
+						else if (64*(i + 1) > k) value[i] &= UINT64_MAX >> (64*(i + 1) - k);
+					}
+					uint64_t carry = 0;
+					for (int i = 0; i < 2*limbCount; i++) {
+						uint128 product = uint128(high[i]) * uint128(c[0]) + uint128(carry);
+						high[i] = uint64_t(product);
+						carry = uint64_t(product >> 64);
+					}
+					limbArithmetic::add(value, high);
+				}
+				doubleLimbArray modulus = {};
+				for (int i = 0; i < limbCount; i++) modulus[i] = Modulus[i];
+				while (!limbArithmetic::lessThan(value, modulus)) limbArithmetic::subtract(value, modulus);
+				limbArray result = {};
+				for (int i = 0; i < limbCount; i++) result[i] = value[i];
+				return result;
+			}
+
+			// Expects value < Modulus
+			static constexpr limbArray toRepresentation(limbArray const& value) noexcept {
+				if constexpr (isSpecialForm) return value;
+				else return context.toMont(value);
+			}
+
+			static constexpr mod_int fromRepresentation(limbArray const& representation) noexcept {
+				mod_int result;
+				result.representation = representation;
+				return result;
+			}
+
+		public:
+			#pragma region Construction
+			constexpr mod_int() noexcept : representation{} {}
+
+			constexpr mod_int(uint64_t value) noexcept : representation{} {
+				limbArray limbs = {};
+				limbs[0] = value;
+				// The value can only be larger for a modulus with a single limb
+				if (!limbArithmetic::lessThan(limbs, Modulus)) limbs[0] %= Modulus[0];
+				representation = toRepresentation(limbs);
+			}
+
+			explicit mod_int(uint_limited<bitSize> value) : representation{} {
+				uint_limited<bitSize> modulusValue = modulus();
+				if (value >= modulusValue) value %= modulusValue;
+				limbArray limbs;
+				value.exportBits(std::span<uint64_t>(limbs));
+				representation = toRepresentation(limbs);
+			}
+			#pragma endregion Construction
+
+			#pragma region Conversion
+			static uint_limited<bitSize> modulus() {
+				uint_limited<bitSize> value;
+				value.importBits(std::span<const uint64_t>(Modulus));
+				return value;
+			}
+
+			// Returns the reduced value as limbs
+			constexpr limbArray limbs() const noexcept {
+				if constexpr (isSpecialForm) return representation;
+				else return context.fromMont(representation);
+			}
+
+			uint_limited<bitSize> value() const {
+				limbArray reduced = limbs();
+				uint_limited<bitSize> result;
+				result.importBits(std::span<const uint64_t>(reduced));
+				return result;
+			}
+
+			std::string toString() const {
+				return value().toString();
+			}
+
+			friend std::ostream& operator<<(std::ostream& os, mod_int const& value) {
+				return os << value.value();
+			}
+			#pragma endregion Conversion
+
+			#pragma region Arithmetic
+			// The sum of two values smaller than Modulus can overflow the limbs, subtracting Modulus wraps it back
+			constexpr mod_int& operator+= (mod_int const& rhs) noexcept {
+				uint64_t carry = limbArithmetic::add(representation, rhs.representation);
+				if (carry || !limbArithmetic::lessThan(representation, Modulus)) limbArithmetic::subtract(representation, Modulus);
+				return *this;
+			}
+			constexpr mod_int operator+ (mod_int const& rhs) const noexcept {
+				mod_int result = *this;
+				return result += rhs;
+			}
+
+			constexpr mod_int& operator-= (mod_int const& rhs) noexcept {
+				if (limbArithmetic::subtract(representation, rhs.representation)) limbArithmetic::add(representation, Modulus);
+				return *this;
+			}
+			constexpr mod_int operator- (mod_int const& rhs) const noexcept {
+				mod_int result = *this;
+				return result -= rhs;
+			}
+
+			constexpr mod_int operator- () const noexcept {
+				return mod_int() - *this;
+			}
+
+			constexpr mod_int& operator*= (mod_int const& rhs) noexcept {
+				if constexpr (isSpecialForm) representation = fold(limbArithmetic::multiply(representation, rhs.representation));
+				else representation = context.mul(representation, rhs.representation);
+				return *this;
+			}
+			constexpr mod_int operator* (mod_int const& rhs) const noexcept {
+				mod_int result = *this;
+				return result *= rhs;
+			}
+
+			// Left to right binary exponentiation, the exponent is given as limbs (least significant limb first)
+			constexpr mod_int pow(std::span<const uint64_t> exp) const noexcept {
+				mod_int result = 1;
+				for (int i = int(exp.size())*64 - 1; i >= 0; i--) {
+					result *= result;
+					if ((exp[i / 64] >> (i % 64)) & 1) result *= *this;
+				}
+				return result;
+			}
+
+			constexpr mod_int pow(uint64_t exp) const noexcept {
+				std::array<uint64_t, 1> expLimbs = {exp};
+				return pow(std::span<const uint64_t>(expLimbs).first(exp != 0));
+			}
+
+			template <int expBitSize>
+			mod_int pow(uint_limited<expBitSize> const& exp) const {
+				std::array<uint64_t, (expBitSize + 63) / 64> expLimbs;
+				exp.exportBits(std::span<uint64_t>(expLimbs));
+				return pow(std::span<const uint64_t>(expLimbs));
+			}
+
+			// Uses Fermat's little theorem (value^(Modulus - 2)), so the modulus has to be prime
+			// Throws std::domain_error for zero
+			constexpr mod_int inverse() const {
+				if (*this == mod_int()) throw std::domain_error("Zero has no inverse");
+				limbArray exp = Modulus;
+				limbArithmetic::subtract(exp, limbArray{2});
+				return pow(std::span<const uint64_t>(exp));
+			}
+			#pragma endregion Arithmetic
+
+			#pragma region Comparison
+			// Both values are reduced, so comparing the representations is enough
+			constexpr bool operator== (mod_int const& rhs) const noexcept {
+				return representation == rhs.representation;
+			}
+			#pragma endregion Comparison
+	};
+}
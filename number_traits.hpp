@@ -0,0 +1,86 @@
+#pragma once
+#include "int128.hpp"
+#include "int_limited.hpp"
+#include <cstdint>
+#include <span>
+#include <limits>
+#include <type_traits>
+
+namespace largeNumberLibrary {
+	// Describes how an integer type is stored, so that generic code can work with any of them
+	// bitSize - the amount of bits of the value
+	// isSigned - whether the value is in two's complement
+	// limb_type - the unsigned type of a single word (limb) of the representation
+	// limbCount - the amount of limbs, the least significant limb has the index 0
+	// limb(value, index) - returns a single limb of the (two's complement) representation
+	// fromLimbs(limbs) - creates a value from limbs, missing limbs are zero and extra limbs are ignored
+	template <typename T>
+	struct number_traits;
+
+	// Standard integers consist of a single limb
+	template <typename T>
+	requires (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+	struct number_traits<T> {
+		using limb_type = std::make_unsigned_t<T>;
+		static constexpr int bitSize = std::numeric_limits<limb_type>::digits;
+		static constexpr bool isSigned = std::is_signed_v<T>;
+		static constexpr int limbCount = 1;
+
+		static constexpr limb_type limb(T const& value, int index) noexcept {
+			return index == 0 ? limb_type(value) : 0;
+		}
+		static constexpr T fromLimbs(std::span<const limb_type> limbs) noexcept {
+			return limbs.empty() ? T(0) : T(limbs[0]);
+		}
+	};
+
+	template <>
+	struct number_traits<int128> {
+		using limb_type = uint64_t;
+		static constexpr int bitSize = 128;
+		static constexpr bool isSigned = true;
+		static constexpr int limbCount = 2;
+
+		static constexpr limb_type limb(int128 const& value, int index) noexcept {
+			if (index == 0) return uint64_t(value);
+			return index == 1 ? uint64_t(value >> 64) : 0;
+		}
+		static constexpr int128 fromLimbs(std::span<const limb_type> limbs) noexcept {
+			return int128(limbs.size() > 1 ? limbs[1] : 0, limbs.empty() ? 0 : limbs[0]);
+		}
+	};
+
+	template <>
+	struct number_traits<uint128> {
+		using limb_type = uint64_t;
+		static constexpr int bitSize = 128;
+		static constexpr bool isSigned = false;
+		static constexpr int limbCount = 2;
+
+		static constexpr limb_type limb(uint128 const& value, int index) noexcept {
+			if (index == 0) return uint64_t(value);
+			return index == 1 ? uint64_t(value >> 64) : 0;
+		}
+		static constexpr uint128 fromLimbs(std::span<const limb_type> limbs) noexcept {
+			return uint128(limbs.size() > 1 ? limbs[1] : 0, limbs.empty() ? 0 : limbs[0]);
+		}
+	};
+
+	// The limbs are the 32 bit words, which are read through a view (so no copy is made)
+	template <int bitSize_, bool isSigned_>
+	struct number_traits<int_limited<bitSize_, isSigned_>> {
+		using limb_type = uint32_t;
+		static constexpr int bitSize = bitSize_;
+		static constexpr bool isSigned = isSigned_;
+		static constexpr int limbCount = bitSize_/32 + (bitSize_%32 > 0);
+
+		static limb_type limb(int_limited<bitSize_, isSigned_> const& value, int index) {
+			return value.view()[index];
+		}
+		static int_limited<bitSize_, isSigned_> fromLimbs(std::span<const limb_type> limbs) {
+			int_limited<bitSize_, isSigned_> value;
+			value.importBits(limbs);
+			return value;
+		}
+	};
+}
@@ -0,0 +1,293 @@
+#pragma once
+#include "constants.hpp"
+#include "int_limited.hpp"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <span>
+#include <bit>
+#include <algorithm>
+#include <stdexcept>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define LARGE_NUMBER_LIBRARY_MMAP
+#endif
+
+// Binary formats for storing int_limited values
+//
+// Fixed width arrays (writeArray, readArray, MappedArray)
+// Every field is little endian:
+//   4 bytes  magic "LNLA"
+//   4 bytes  bitSize
+//   8 bytes  count
+//   8 bytes  checksum (see arrayChecksum)
+//   count records, each of (bitSize + 31) / 32 words of 32 bits, least significant word first
+// Negative values are stored in two's complement, the same as in memory
+// The header is a multiple of 8 bytes, so every record is aligned to 4 bytes in a memory map
+// (which allows viewing the words of a record in place with int_limited_view)
+//
+// Variable width values (appendVariable, readVariable)
+//   LEB128 varint of (byteCount << 1 | sign), followed by byteCount bytes of the magnitude, little endian
+//   Zero is the single byte 0x00, so sparse data (mostly small values) takes very little space
+namespace largeNumberLibrary {
+	constexpr char ARRAY_MAGIC[4] = {'L', 'N', 'L', 'A'};
+	constexpr std::size_t ARRAY_HEADER_SIZE = 24;
+
+	// Size of a single record in bytes
+	constexpr std::size_t arrayRecordSize(int bitSize) {
+		return std::size_t((bitSize + 31) / 32) * 4;
+	}
+
+	// Reads an unsigned little endian value of up to 8 bytes
+	inline uint64_t loadLittleEndian(const uint8_t* bytes, std::size_t byteCount) {
+		uint64_t value = 0;
+		for (std::size_t i = 0; i < byteCount; i++) {
+			value |= uint64_t(bytes[i]) << (8 * i);
+		}
+		return value;
+	}
+
+	inline void storeLittleEndian(uint8_t* bytes, uint64_t value, std::size_t byteCount) {
+		for (std::size_t i = 0; i < byteCount; i++) {
+			bytes[i] = uint8_t(value >> (8 * i));
+		}
+	}
+
+	// Continues the checksum over a single record
+	// Every 8 bytes of the record (the last chunk is zero padded) are mixed into the checksum
+	// Start with HASH_SECRET_0 for an empty array
+	inline uint64_t arrayChecksum(uint64_t checksum, std::span<const uint8_t> record) {
+		for (std::size_t i = 0; i < record.size(); i += 8) {
+			uint64_t chunk = loadLittleEndian(record.data() + i, std::min<std::size_t>(8, record.size() - i));
+			checksum = hashMix(checksum ^ chunk, HASH_SECRET_1);
+		}
+		return checksum;
+	}
+
+	// Validates the header and returns the amount of records
+	// Throws std::domain_error if the header doesn't describe an array of the given bit size
+	inline uint64_t readArrayHeader(const uint8_t* header, int bitSize, uint64_t& checksum) {
+		if (std::memcmp(header, ARRAY_MAGIC, 4) != 0) throw std::domain_error("Invalid int_limited array header");
+		if (loadLittleEndian(header + 4, 4) != uint64_t(bitSize)) throw std::domain_error("Mismatched bit size of int_limited array");
+		checksum = loadLittleEndian(header + 16, 8);
+		return loadLittleEndian(header + 8, 8);
+	}
+
+	// Writes the values as a fixed width array (the format is described above)
+	template <int bitSize, bool isSigned>
+	void writeArray(std::ostream& os, std::vector<int_limited<bitSize, isSigned>> const& values) {
+		const std::size_t recordSize = arrayRecordSize(bitSize);
+		std::vector<uint8_t> record(recordSize);
+		// The checksum is in the header, so the records are exported twice instead of buffering the whole array
+		uint64_t checksum = HASH_SECRET_0;
+		for (int_limited<bitSize, isSigned> const& value : values) {
+			value.exportBytes(record, std::endian::little);
+			checksum = arrayChecksum(checksum, record);
+		}
+		uint8_t header[ARRAY_HEADER_SIZE];
+		std::memcpy(header, ARRAY_MAGIC, 4);
+		storeLittleEndian(header + 4, bitSize, 4);
+		storeLittleEndian(header + 8, values.size(), 8);
+		storeLittleEndian(header + 16, checksum, 8);
+		os.write(reinterpret_cast<const char*>(header), ARRAY_HEADER_SIZE);
+		for (int_limited<bitSize, isSigned> const& value : values) {
+			value.exportBytes(record, std::endian::little);
+			os.write(reinterpret_cast<const char*>(record.data()), recordSize);
+		}
+		return;
+	}
+
+	// Reads a whole fixed width array written by writeArray
+	// Throws std::domain_error on an invalid header, a truncated stream or a mismatched checksum
+	template <int bitSize, bool isSigned = true>
+	std::vector<int_limited<bitSize, isSigned>> readArray(std::istream& is) {
+		uint8_t header[ARRAY_HEADER_SIZE];
+		if (!is.read(reinterpret_cast<char*>(header), ARRAY_HEADER_SIZE)) throw std::domain_error("Truncated int_limited array");
+		uint64_t expectedChecksum;
+		uint64_t count = readArrayHeader(header, bitSize, expectedChecksum);
+
+		const std::size_t recordSize = arrayRecordSize(bitSize);
+		std::vector<uint8_t> record(recordSize);
+		std::vector<int_limited<bitSize, isSigned>> values;
+		uint64_t checksum = HASH_SECRET_0;
+		for (uint64_t i = 0; i < count; i++) {
+			if (!is.read(reinterpret_cast<char*>(record.data()), recordSize)) throw std::domain_error("Truncated int_limited array");
+			checksum = arrayChecksum(checksum, record);
+			values.emplace_back().importBytes(record, std::endian::little);
+		}
+		if (checksum != expectedChecksum) throw std::domain_error("Checksum mismatch of int_limited array");
+		return values;
+	}
+
+	// Read-only access to a fixed width array stored in a file
+	// On POSIX systems the file is memory mapped, so records are only read when they are accessed
+	// (otherwise the whole file is read into memory)
+	// The header (and optionally the checksum) is validated on construction
+	template <int bitSize, bool isSigned = true>
+	class MappedArray {
+		private:
+			static constexpr std::size_t recordSize = arrayRecordSize(bitSize);
+
+			const uint8_t* data = nullptr;
+			std::size_t fileSize = 0;
+			uint64_t count = 0;
+			#ifndef LARGE_NUMBER_LIBRARY_MMAP
+			std::vector<uint8_t> buffer;
+			#endif
+
+			void release() {
+				#ifdef LARGE_NUMBER_LIBRARY_MMAP
+				if (this->data != nullptr) munmap(const_cast<uint8_t*>(this->data), this->fileSize);
+				#endif
+				this->data = nullptr;
+				return;
+			}
+
+		public:
+			// Throws std::runtime_error if the file can't be read
+			// and std::domain_error if it isn't a valid array of this bit size
+			MappedArray(std::string const& path, bool verifyChecksum = true) {
+				#ifdef LARGE_NUMBER_LIBRARY_MMAP
+				int fd = open(path.c_str(), O_RDONLY);
+				if (fd < 0) throw std::runtime_error("Unable to open " + path);
+				struct stat status;
+				if (fstat(fd, &status) != 0) {
+					close(fd);
+					throw std::runtime_error("Unable to read " + path);
+				}
+				this->fileSize = status.st_size;
+				if (this->fileSize >= ARRAY_HEADER_SIZE) {
+					void* mapping = mmap(nullptr, this->fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+					if (mapping == MAP_FAILED) {
+						close(fd);
+						throw std::runtime_error("Unable to map " + path);
+					}
+					this->data = static_cast<const uint8_t*>(mapping);
+				}
+				close(fd);
+				#else
+				std::ifstream file(path, std::ios::binary);
+				if (!file) throw std::runtime_error("Unable to open " + path);
+				this->buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+				this->fileSize = this->buffer.size();
+				this->data = this->buffer.data();
+				#endif
+
+				try {
+					if (this->fileSize < ARRAY_HEADER_SIZE) throw std::domain_error("Truncated int_limited array");
+					uint64_t expectedChecksum;
+					this->count = readArrayHeader(this->data, bitSize, expectedChecksum);
+					if (this->count > (this->fileSize - ARRAY_HEADER_SIZE) / recordSize) throw std::domain_error("Truncated int_limited array");
+					if (verifyChecksum) {
+						uint64_t checksum = HASH_SECRET_0;
+						for (uint64_t i = 0; i < this->count; i++) {
+							checksum = arrayChecksum(checksum, this->record(i));
+						}
+						if (checksum != expectedChecksum) throw std::domain_error("Checksum mismatch of int_limited array");
+					}
+				} catch (...) {
+					this->release();
+					throw;
+				}
+			}
+			MappedArray(MappedArray const&) = delete;
+			MappedArray& operator= (MappedArray const&) = delete;
+			~MappedArray() {
+				this->release();
+			}
+
+			std::size_t size() const {
+				return this->count;
+			}
+
+			// The little endian bytes of a single record, directly in the mapped memory
+			std::span<const uint8_t> record(std::size_t index) const {
+				return std::span<const uint8_t>(this->data + ARRAY_HEADER_SIZE + index * recordSize, recordSize);
+			}
+
+			// A view of the words of a single record, directly in the mapped memory (nothing is copied)
+			// Negative values are viewed as their two's complement bits, the same as int_limited::view()
+			// Only available on little endian machines, since the words are stored in little endian
+			int_limited_view view(std::size_t index) const {
+				if constexpr (std::endian::native != std::endian::little) throw std::domain_error("Views of mapped records require a little endian machine");
+				std::span<const uint8_t> bytes = this->record(index);
+				return int_limited_view(reinterpret_cast<const uint32_t*>(bytes.data()), recordSize / 4);
+			}
+
+			// Copies a single record into an int_limited (a memcpy on little endian machines)
+			int_limited<bitSize, isSigned> operator[] (std::size_t index) const {
+				int_limited<bitSize, isSigned> value;
+				value.importBytes(this->record(index), std::endian::little);
+				return value;
+			}
+
+			int_limited<bitSize, isSigned> at(std::size_t index) const {
+				if (index >= this->count) throw std::out_of_range("Index out of range of int_limited array");
+				return (*this)[index];
+			}
+	};
+
+	// Appends the value in the variable width format (the format is described above)
+	template <int bitSize, bool isSigned>
+	void appendVariable(std::vector<uint8_t>& output, int_limited<bitSize, isSigned> const& value) {
+		bool negative = false;
+		if constexpr (isSigned) negative = value < 0;
+		// Negating the minimum value overflows to itself, which is still the correct magnitude as an unsigned value
+		int_limited<bitSize, false> magnitude = negative ? -value : value;
+		uint64_t byteCount = !magnitude ? 0 : (magnitude.ilog2() + 7) / 8;
+
+		uint64_t prefix = (byteCount << 1) | negative;
+		do {
+			uint8_t byte = prefix & 0x7F;
+			prefix >>= 7;
+			output.push_back(byte | (prefix != 0 ? 0x80 : 0));
+		} while (prefix != 0);
+
+		std::size_t start = output.size();
+		output.resize(start + byteCount);
+		magnitude.exportBytes(std::span<uint8_t>(output.data() + start, byteCount), std::endian::little);
+		return;
+	}
+
+	// Reads a single value in the variable width format from [first, last) and returns a pointer past it
+	// Throws std::domain_error if the data is truncated and std::range_error if the value doesn't fit
+	template <int bitSize, bool isSigned>
+	const uint8_t* readVariable(const uint8_t* first, const uint8_t* last, int_limited<bitSize, isSigned>& value) {
+		uint64_t prefix = 0;
+		int shift = 0;
+		while (true) {
+			if (first == last || shift > 63) throw std::domain_error("Truncated variable width int_limited");
+			uint8_t byte = *first++;
+			prefix |= uint64_t(byte & 0x7F) << shift;
+			shift += 7;
+			if (!(byte & 0x80)) break;
+		}
+		const bool negative = prefix & 1;
+		const uint64_t byteCount = prefix >> 1;
+		if (uint64_t(last - first) < byteCount) throw std::domain_error("Truncated variable width int_limited");
+		if (negative && !isSigned) throw std::range_error("Negative value for uint_limited");
+
+		// Leading zero bytes are allowed, they just don't count towards the bit length
+		uint64_t significantBytes = byteCount;
+		while (significantBytes > 0 && first[significantBytes - 1] == 0) significantBytes--;
+		uint64_t bitLength = significantBytes == 0 ? 0 : (significantBytes - 1) * 8 + std::bit_width(first[significantBytes - 1]);
+		if (bitLength > uint64_t(bitSize)) throw std::range_error("Variable width value doesn't fit into int_limited");
+
+		int_limited<bitSize, false> magnitude;
+		magnitude.importBytes(std::span<const uint8_t>(first, significantBytes), std::endian::little);
+		if constexpr (isSigned) {
+			// The magnitude of the minimum value is one larger than the maximum value
+			int_limited<bitSize, false> limit = int_limited<bitSize, false>(1) << (bitSize-1);
+			if (magnitude > limit || (magnitude == limit && !negative)) throw std::range_error("Variable width value doesn't fit into int_limited");
+		}
+		value = magnitude;
+		if (negative) value = -value;
+		return first + byteCount;
+	}
+}
@@ -5,11 +5,25 @@
 #include <cmath>
 #include <vector>
 #include <chrono>
+#include <sstream>
 #include <boost/multiprecision/cpp_int.hpp>
 #include "../int128.hpp"
 
 typedef boost::multiprecision::int128_t boostInt128;
+typedef boost::multiprecision::uint128_t boostUint128;
 typedef largeNumberLibrary::int128 int128;
+typedef largeNumberLibrary::uint128 uint128;
+
+// int128 must be usable in constant expressions, so a failure here stops the compilation
+static_assert(int128("-170141183460469231731687303715884105728") == int128(largeNumberLibrary::BIT64_ON, 0));
+static_assert(int128(UINT64_MAX) * int128(UINT64_MAX) == int128(UINT64_MAX - 1, 1));
+static_assert(int128(1, 5) / int128(3) == int128(uint64_t(6148914691236517207)) && int128(1, 5) % int128(3) == int128(0));
+static_assert((int128(1) << 100 | int128(12345)) % ((int128(1) << 70) + int128(3)) == int128(uint64_t(0x3f), uint64_t(0xffffffff4000303c)));
+static_assert(int128(-1) >> 127 == int128(1) && (int128(-7) ^ int128(-7)) == int128(0));
+static_assert(std::is_trivially_copyable_v<int128> && std::is_nothrow_copy_constructible_v<int128>);
+static_assert(int128(largeNumberLibrary::UINT63_MAX, UINT64_MAX).isqrt() == int128(uint64_t(13043817825332782212ULL)) && (int128(1) << 126).isqrt() == int128(1) << 63 && int128(UINT64_MAX).isqrt() == int128(UINT32_MAX));
+static_assert(int128(1).ilog2() == 1 && int128(UINT64_MAX).ilog2() == 64 && (uint128(1) << 127).ilog2() == 128);
+static_assert(int128(-7).powMod(3, 10) == int128(7) && int128::gcd(-12, 18) == int128(6) && int128(3).pow(81) == int128(3).pow(80) * int128(3));
 
 // From https://www.reddit.com/r/C_Programming/comments/ozew2u/comment/h7zijm8
 uint64_t rnd64(uint64_t n)
@@ -209,7 +223,11 @@ bool verifyCorrectnessOfMyInt128(int testNumberCount = 1000, uint64_t randState
 			if (testNumbersBoost[j] == 0) continue;
 			boostInt128 boostResult = testNumbersBoost[i] % testNumbersBoost[j];
 			myInt128 myResult = testNumbersMyInt[i] % testNumbersMyInt[j];
-			if (!twoInt128TypesEqual<boostInt128, myInt128>(boostResult, myResult)) {
+			// divmod has to match both of the separate operators
+			std::pair<myInt128, myInt128> quotientAndRemainder = testNumbersMyInt[i].divmod(testNumbersMyInt[j]);
+			if (!twoInt128TypesEqual<boostInt128, myInt128>(boostResult, myResult)
+				|| !twoInt128TypesEqual<boostInt128, myInt128>(testNumbersBoost[i] / testNumbersBoost[j], quotientAndRemainder.first)
+				|| quotientAndRemainder.second != myResult) {
 				std::cout << "FAILED: " << testNumbersBoost[i] << " % " << testNumbersBoost[j] << std::endl;
 				printInt128Words<myInt128>(testNumbersMyInt[i]);
 				printInt128Words<myInt128>(testNumbersMyInt[j]);
@@ -222,6 +240,196 @@ bool verifyCorrectnessOfMyInt128(int testNumberCount = 1000, uint64_t randState
 	std::cout << "PASSED MODULO" << std::endl;
 	std::cout << "------------------" << std::endl;
 
+	std::cout << "VERIFYING THREE-WAY COMPARISON" << std::endl;
+	for (int i = 0; i < testNumberCount; i++) {
+		for (int j = 0; j < testNumberCount; j++) {
+			boostInt128 a = testNumbersBoost[i];
+			boostInt128 b = testNumbersBoost[j];
+			// boost int128_t is sign-magnitude, so the absolute value never overflows
+			if ((testNumbersMyInt[i] <=> testNumbersMyInt[j]) != (a.compare(b) <=> 0)
+				|| testNumbersMyInt[i].compareAbs(testNumbersMyInt[j]) != (boostInt128(abs(a)).compare(boostInt128(abs(b))) <=> 0)
+				|| (a == b && testNumbersMyInt[i].hash() != testNumbersMyInt[j].hash())) {
+				std::cout << "FAILED: " << testNumbersBoost[i] << " <=> " << testNumbersBoost[j] << std::endl;
+				return false;
+			}
+		}
+	}
+	std::cout << "PASSED THREE-WAY COMPARISON" << std::endl;
+	std::cout << "------------------" << std::endl;
+
+	std::cout << "VERIFYING STREAM EXTRACTION" << std::endl;
+	std::stringstream stream;
+	for (int i = 0; i < testNumberCount; i++) {
+		stream << testNumbersBoost[i] << " ";
+	}
+	stream << "170141183460469231731687303715884105728 -0x80000000000000000000000000000000";
+	for (int i = 0; i < testNumberCount; i++) {
+		int128 parsed;
+		if (!(stream >> parsed) || parsed != testNumbersMyInt[i]) {
+			std::cout << "FAILED: >> " << testNumbersBoost[i] << std::endl;
+			return false;
+		}
+	}
+	int128 tooLarge, minValue;
+	stream >> tooLarge;
+	bool overflowFailed = stream.fail();
+	stream.clear();
+	stream.unsetf(std::ios_base::basefield);
+	if (!overflowFailed || tooLarge != int128(largeNumberLibrary::UINT63_MAX, UINT64_MAX) || !(stream >> minValue) || minValue != int128(largeNumberLibrary::BIT64_ON, 0) || !stream.eof()) {
+		std::cout << "FAILED: >> out of range" << std::endl;
+		return false;
+	}
+	// A sign has to be followed directly by the digits
+	for (std::string invalid : {"-", "- 5", "-+5", "+-5", "-x"}) {
+		std::istringstream invalidStream(invalid);
+		int128 parsed = 5;
+		if ((invalidStream >> parsed) || parsed != 0) {
+			std::cout << "FAILED: >> " << invalid << std::endl;
+			return false;
+		}
+	}
+	std::istringstream hexStream("-0x7f +0b101");
+	int128 negativeHex, positiveBinary;
+	hexStream.unsetf(std::ios_base::basefield);
+	if (!(hexStream >> negativeHex >> positiveBinary) || negativeHex != -127 || positiveBinary != 5) {
+		std::cout << "FAILED: >> with a sign and a prefix" << std::endl;
+		return false;
+	}
+	std::cout << "PASSED STREAM EXTRACTION" << std::endl;
+	std::cout << "------------------" << std::endl;
+
+	std::cout << "VERIFYING TO_CHARS AND FROM_CHARS" << std::endl;
+	char buffer[myInt128::maxDigits(2)];
+	for (int i = 0; i < testNumberCount; i++) {
+		for (int base : {10, 16, 2, 7, 36}) {
+			std::string expected = base == 10 ? testNumbersBoost[i].str() : "";
+			std::to_chars_result written = to_chars(buffer, buffer + sizeof(buffer), testNumbersMyInt[i], base);
+			myInt128 parsed;
+			std::from_chars_result read = from_chars(buffer, written.ptr, parsed, base);
+			if (written.ec != std::errc() || read.ec != std::errc() || read.ptr != written.ptr || parsed != testNumbersMyInt[i]
+				|| (base == 10 && (std::string(buffer, written.ptr) != expected || testNumbersMyInt[i].toString() != expected))) {
+				std::cout << "FAILED: to_chars/from_chars of " << testNumbersBoost[i] << " in base " << base << std::endl;
+				return false;
+			}
+		}
+	}
+	myInt128 outOfRange = 5;
+	std::string minString = "-170141183460469231731687303715884105728";
+	if (myInt128(largeNumberLibrary::BIT64_ON, 0).toString() != minString || myInt128(0).toString() != "0" || myInt128(0).toString(2) != "0"
+		|| from_chars(minString.data() + 1, minString.data() + minString.size(), outOfRange).ec != std::errc::result_out_of_range || outOfRange != 5
+		|| to_chars(buffer, buffer + minString.size() - 1, myInt128(largeNumberLibrary::BIT64_ON, 0)).ec != std::errc::value_too_large) {
+		std::cout << "FAILED: to_chars/from_chars edge cases" << std::endl;
+		return false;
+	}
+	std::cout << "PASSED TO_CHARS AND FROM_CHARS" << std::endl;
+	std::cout << "------------------" << std::endl;
+
+	return true;
+}
+
+// Every operation is compared with boost uint128_t, which (unlike boost int128_t) is a plain unsigned 128 bit value
+bool verifyCorrectnessOfUint128(int testNumberCount = 1000, uint64_t randState = 1) {
+	std::cout << "====================================================================================================" << std::endl;
+	std::cout << "VERIFYING ARITHMETIC CORRECTNESS OF " << uint128::className() << " WITH BOOST uint128_t" << std::endl;
+	std::cout << "====================================================================================================" << std::endl;
+
+	std::cout << "GENERATING TEST NUMBERS..." << std::endl;
+	std::vector<boostUint128> testNumbersBoost = {0, 1, UINT64_MAX};
+	std::vector<uint128> testNumbersMyInt = {0, 1, UINT64_MAX};
+	for (int i = testNumbersBoost.size(); i < testNumberCount; i++) {
+		std::vector<uint64_t> words = genTwoUint64(randState);
+		randState += 2;
+		testNumbersBoost.push_back((boostUint128(words[0]) << 64) | words[1]);
+		testNumbersMyInt.push_back(uint128(words[0], words[1]));
+	}
+	auto equal = [](boostUint128 const& a, uint128 const& b) {
+		return uint64_t(a) == uint64_t(b) && uint64_t(a >> 64) == uint64_t(b >> 64);
+	};
+
+	std::cout << "------------------" << std::endl;
+	std::cout << "VERIFYING ARITHMETIC AND COMPARISON" << std::endl;
+	for (int i = 0; i < testNumberCount; i++) {
+		for (int j = 0; j < testNumberCount; j++) {
+			boostUint128 a = testNumbersBoost[i], b = testNumbersBoost[j];
+			uint128 x = testNumbersMyInt[i], y = testNumbersMyInt[j];
+			// boost throws on a negative result, so the subtraction is done as an addition of the two's complement
+			bool passed = equal(a + b, x + y) && equal(a + (~b + 1), x - y) && equal(a * b, x * y)
+				&& (x <=> y) == (a.compare(b) <=> 0) && (x == y) == (x.hash() == y.hash())
+				&& equal(a << (j % 128), x << (j % 128)) && equal(a >> (i % 128), x >> (i % 128));
+			if (b != 0) {
+				std::pair<uint128, uint128> quotientAndRemainder = x.divmod(y);
+				passed = passed && equal(a / b, quotientAndRemainder.first) && equal(a % b, quotientAndRemainder.second)
+					&& x / y == quotientAndRemainder.first && x % y == quotientAndRemainder.second;
+			}
+			if (!passed) {
+				std::cout << "FAILED: " << a << " and " << b << std::endl;
+				return false;
+			}
+		}
+	}
+	std::cout << "PASSED ARITHMETIC AND COMPARISON" << std::endl;
+	std::cout << "------------------" << std::endl;
+
+	std::cout << "VERIFYING CONVERSIONS" << std::endl;
+	std::stringstream stream;
+	for (int i = 0; i < testNumberCount; i++) {
+		uint128 value = testNumbersMyInt[i];
+		// Converting to int128 and back keeps the bits
+		char buffer[uint128::maxDigits(36)];
+		uint128 parsed;
+		std::to_chars_result written = to_chars(buffer, buffer + sizeof(buffer), value, 36);
+		from_chars(buffer, written.ptr, parsed, 36);
+		if (value.toString() != testNumbersBoost[i].str() || uint128(int128(value)) != value || uint128(value.toString().c_str()) != value || parsed != value) {
+			std::cout << "FAILED: conversion of " << testNumbersBoost[i] << std::endl;
+			return false;
+		}
+		stream << std::hex << std::showbase << testNumbersBoost[i] << " ";
+	}
+	stream << "340282366920938463463374607431768211456";
+	stream.unsetf(std::ios_base::basefield);
+	for (int i = 0; i < testNumberCount; i++) {
+		uint128 parsed;
+		if (!(stream >> parsed) || parsed != testNumbersMyInt[i]) {
+			std::cout << "FAILED: >> " << testNumbersBoost[i] << std::endl;
+			return false;
+		}
+	}
+	uint128 tooLarge;
+	stream >> tooLarge;
+	if (!stream.fail() || tooLarge != uint128(UINT64_MAX, UINT64_MAX) || uint128(-1) != tooLarge || uint128(int128(-1)) != tooLarge) {
+		std::cout << "FAILED: >> out of range" << std::endl;
+		return false;
+	}
+	std::cout << "PASSED CONVERSIONS" << std::endl;
+	std::cout << "------------------" << std::endl;
+
+	std::cout << "VERIFYING MATH" << std::endl;
+	for (int i = 0; i < testNumberCount; i++) {
+		boostUint128 a = testNumbersBoost[i];
+		uint128 x = testNumbersMyInt[i];
+		if ((a != 0 && x.ilog2() != int(boost::multiprecision::msb(a)) + 1) || !equal(boost::multiprecision::sqrt(a), x.isqrt())
+			|| !equal(boost::multiprecision::pow(a, i % 5), x.pow(i % 5))) {
+			std::cout << "FAILED: math of " << a << std::endl;
+			return false;
+		}
+		// The products of the modular functions are checked on a smaller subset
+		for (int j = 0; j < testNumberCount; j += 37) {
+			boostUint128 b = testNumbersBoost[j];
+			uint128 y = testNumbersMyInt[j];
+			uint128 modulus = testNumbersMyInt[(i + j) % testNumberCount] | uint128(1);
+			boostUint128 boostModulus = testNumbersBoost[(i + j) % testNumberCount] | 1;
+			boost::multiprecision::uint256_t product = boost::multiprecision::uint256_t(a) * b % boostModulus;
+			if (!equal(boost::multiprecision::gcd(a, b), uint128::gcd(x, y))
+				|| !equal(boostUint128(product), uint128::mulMod(x, y, modulus))
+				|| !equal(boost::multiprecision::powm(a, b, boostModulus), x.powMod(y, modulus))) {
+				std::cout << "FAILED: math of " << a << " and " << b << " modulo " << boostModulus << std::endl;
+				return false;
+			}
+		}
+	}
+	std::cout << "PASSED MATH" << std::endl;
+	std::cout << "------------------" << std::endl;
+
 	return true;
 }
 
@@ -499,6 +707,7 @@ int main() {
 	uint64_t randState = 1;
 	std::vector<std::vector<double>> averageBenchmarkResults;
 	// verifyCorrectnessOfMyInt128<int128>();
+	// verifyCorrectnessOfUint128();
 	speedBenchmarkBoost(testCaseAmount);
 	speedBenchmarkMyInt<int128>(testCaseAmount);
 
@@ -6,8 +6,16 @@
 #include <vector>
 #include <chrono>
 #include <array>
+#include <algorithm>
+#include <unordered_set>
+#include <sstream>
+#include <iomanip>
+#include <fstream>
 #include <boost/multiprecision/cpp_int.hpp>
 #include "../int_limited.hpp"
+#include "../serialization.hpp"
+#include "../number_traits.hpp"
+#include "../modular.hpp"
 
 typedef boost::multiprecision::cpp_int boostInt;
 
@@ -278,6 +286,602 @@ bool verifyCorrectnessOfInt_limited(int testNumberCount = 1000, uint64_t randSta
 	return true;
 }
 
+// Compares the words of an unsigned value with a non-negative boost integer
+template <int bitSize>
+bool uint_limitedEqualBoost(uint_limited<bitSize> const& a, boostInt b) {
+	std::vector<uint32_t> words = a.exportBits();
+	for (uint32_t word : words) {
+		if (word != uint32_t(b & UINT32_MAX)) return false;
+		b >>= 32;
+	}
+	return b == 0;
+}
+
+// Reuses the signed test numbers, which wrap around to their unsigned value modulo 2^bitSize
+template <int bitSize>
+bool verifyCorrectnessOfUint_limited(int testNumberCount = 1000, uint64_t randState = 1) {
+	std::cout << "====================================================================================================" << std::endl;
+	std::cout << "VERIFYING ARITHMETIC CORRECTNESS OF " << uint_limited<bitSize>::className() << " WITH BOOST cpp_int" << std::endl;
+	std::cout << "====================================================================================================" << std::endl;
+
+	boostInt bitLimiter = 1;
+	bitLimiter <<= bitSize;
+	std::vector<boostInt> testNumbersBoost = generateBoostIntegers(testNumberCount, bitSize, randState);
+	std::vector<int_limited<bitSize>> signedNumbers = generateInt_limited<bitSize>(testNumberCount, randState);
+	std::vector<uint_limited<bitSize>> testNumbersUint_limited;
+	for (int i = 0; i < testNumberCount; i++) {
+		testNumbersBoost[i] %= bitLimiter;
+		if (testNumbersBoost[i] < 0) testNumbersBoost[i] += bitLimiter;
+		testNumbersUint_limited.push_back(signedNumbers[i]);
+		if (int_limited<bitSize>(testNumbersUint_limited[i]) != signedNumbers[i] || !uint_limitedEqualBoost<bitSize>(testNumbersUint_limited[i], testNumbersBoost[i])) {
+			std::cout << "\033[1;31mFAILED: conversion of " << signedNumbers[i] << "\033[0m" << std::endl;
+			return false;
+		}
+	}
+
+	std::vector<std::string> operationNames = {"ADDITION", "SUBTRACTION", "MULTIPLICATION", "DIVISION", "MODULO", "COMPARISON"};
+	for (int op = 0; op < operationNames.size(); op++) {
+		std::cout << "VERIFYING " << operationNames[op] << ": ";
+		for (int i = 0; i < testNumberCount; i++) {
+			for (int j = 0; j < testNumberCount; j++) {
+				boostInt const& a = testNumbersBoost[i];
+				boostInt const& b = testNumbersBoost[j];
+				uint_limited<bitSize> const& myA = testNumbersUint_limited[i];
+				uint_limited<bitSize> const& myB = testNumbersUint_limited[j];
+				if ((op == 3 || op == 4) && b == 0) continue;
+				boostInt boostResult;
+				uint_limited<bitSize> myResult;
+				switch (op) {
+					case 0: boostResult = a + b; myResult = myA + myB; break;
+					case 1: boostResult = a - b + bitLimiter; myResult = myA - myB; break;
+					case 2: boostResult = a * b; myResult = myA * myB; break;
+					case 3: boostResult = a / b; myResult = myA / myB; break;
+					case 4: boostResult = a % b; myResult = myA % myB; break;
+					case 5: boostResult = (a < b) + 2*(a > b); myResult = (myA < myB) + 2*(myA > myB); break;
+				}
+				boostResult %= bitLimiter;
+				if (!uint_limitedEqualBoost<bitSize>(myResult, boostResult)) {
+					std::cout << "\033[1;31mFAILED: " << operationNames[op] << " of " << a << " and " << b << "\033[0m" << std::endl;
+					return false;
+				}
+			}
+		}
+		std::cout << "\033[32mPASSED " << operationNames[op] << "\033[0m" << std::endl;
+	}
+	return true;
+}
+
+// Values constructed from 64 bit integers with a zero low word (±k*2^32), combined with small values
+// Only used for bit sizes of at least 128, so that no result overflows
+template <int bitSize>
+bool verifyZeroLowWord() {
+	std::cout << "====================================================================================================" << std::endl;
+	std::cout << "VERIFYING VALUES WITH A ZERO LOW WORD OF " << int_limited<bitSize>::className() << " WITH BOOST cpp_int" << std::endl;
+	std::cout << "====================================================================================================" << std::endl;
+
+	std::vector<boostInt> testNumbersBoost;
+	std::vector<int_limited<bitSize>> testNumbersInt_limited;
+	for (int64_t k : {1, 3, 7, 0x7fffffff}) {
+		testNumbersBoost.push_back(boostInt(k) << 32);
+		testNumbersInt_limited.push_back(int_limited<bitSize>(uint64_t(k) << 32));
+		testNumbersBoost.push_back(-(boostInt(k) << 32));
+		testNumbersInt_limited.push_back(int_limited<bitSize>(int64_t(-(k << 32))));
+	}
+	for (int64_t small : {0, 3, 7, -7}) {
+		testNumbersBoost.push_back(small);
+		testNumbersInt_limited.push_back(int_limited<bitSize>(small));
+	}
+
+	for (int i = 0; i < testNumbersBoost.size(); i++) {
+		boostInt const& a = testNumbersBoost[i];
+		int_limited<bitSize> const& myA = testNumbersInt_limited[i];
+		std::stringstream printed;
+		printed << myA;
+		if (printed.str() != a.str() || myA != int_limited<bitSize>(a.str()) || -myA != int_limited<bitSize>(boostInt(-a).str())) {
+			std::cout << "\033[1;31mFAILED: printing of " << a << " (" << printed.str() << ")\033[0m" << std::endl;
+			return false;
+		}
+		for (int j = 0; j < testNumbersBoost.size(); j++) {
+			boostInt const& b = testNumbersBoost[j];
+			int_limited<bitSize> const& myB = testNumbersInt_limited[j];
+			bool failed = (myA + myB).toString() != boostInt(a + b).str() || (myA - myB).toString() != boostInt(a - b).str()
+				|| (myA * myB).toString() != boostInt(a * b).str();
+			if (b != 0) failed = failed || (myA / myB).toString() != boostInt(a / b).str() || (myA % myB).toString() != boostInt(a % b).str();
+			if (failed) {
+				std::cout << "\033[1;31mFAILED: arithmetic of " << a << " and " << b << "\033[0m" << std::endl;
+				return false;
+			}
+		}
+	}
+	std::cout << "\033[32mPASSED VALUES WITH A ZERO LOW WORD\033[0m" << std::endl;
+	return true;
+}
+
+// Checks importBytes against boost::multiprecision::import_bits and that every span based import/export round trips
+template <int bitSize>
+bool verifyBitImportExport(int testNumberCount = 1000, uint64_t randState = 1) {
+	std::cout << "VERIFYING BIT IMPORT/EXPORT OF " << int_limited<bitSize>::className() << ": ";
+	constexpr int wordCount = bitSize/32 + (bitSize%32 > 0);
+	boostInt bitLimiter = 1;
+	bitLimiter <<= bitSize;
+	for (int i = 0; i < testNumberCount; i++) {
+		// includes byte counts that aren't a multiple of a word and that are larger than the value
+		int byteCount = 1 + rnd64(randState) % (4*wordCount + 6);
+		std::vector<uint8_t> bytes(byteCount);
+		for (int j = 0; j < byteCount; j++) bytes[j] = uint8_t(rnd64(randState + j + 1));
+		randState += byteCount + 1;
+
+		boostInt boostNum;
+		boost::multiprecision::import_bits(boostNum, bytes.begin(), bytes.end(), 8, true);
+		boostNum %= bitLimiter;
+
+		int_limited<bitSize> bigEndian;
+		bigEndian.importBytes(bytes);
+		std::vector<uint32_t> words = bigEndian.exportBits();
+		for (int j = 0; j < wordCount; j++) {
+			if (words[j] != uint32_t((boostNum >> (32*j)) & UINT32_MAX)) {
+				std::cout << "\033[1;31mFAILED: importBytes of " << boostNum << "\033[0m" << std::endl;
+				return false;
+			}
+		}
+
+		std::vector<uint8_t> reversed(bytes.rbegin(), bytes.rend());
+		int_limited<bitSize> littleEndian;
+		littleEndian.importBytes(reversed, std::endian::little);
+
+		std::vector<uint8_t> exported(byteCount);
+		bigEndian.exportBytes(exported);
+		int_limited<bitSize> reimported;
+		reimported.importBytes(exported);
+
+		std::vector<uint64_t> words64(wordCount/2 + 1);
+		bigEndian.exportBits(std::span<uint64_t>(words64));
+		int_limited<bitSize> fromWords64;
+		fromWords64.importBits(std::span<const uint64_t>(words64));
+
+		std::array<uint32_t, wordCount> words32;
+		bigEndian.exportBits(std::span<uint32_t>(words32));
+		int_limited<bitSize> fromWords32;
+		fromWords32.importBits(std::span<const uint32_t>(words32));
+
+		if (littleEndian != bigEndian || reimported != bigEndian || fromWords64 != bigEndian || fromWords32 != bigEndian) {
+			std::cout << "\033[1;31mFAILED: round trip of " << boostNum << "\033[0m" << std::endl;
+			return false;
+		}
+	}
+	std::cout << "\033[32mPASSED BIT IMPORT/EXPORT\033[0m" << std::endl;
+	return true;
+}
+
+// Views are unsigned, so the values are generated from random words and compared with non-negative boost integers
+template <int bitSize>
+bool verifyView(int testNumberCount = 1000, uint64_t randState = 1) {
+	std::cout << "VERIFYING VIEWS OF " << int_limited<bitSize>::className() << ": ";
+	constexpr int wordCount = bitSize/32 + (bitSize%32 > 0);
+	boostInt bitLimiter = boostInt(1) << bitSize;
+	std::vector<uint_limited<bitSize>> values(testNumberCount);
+	std::vector<boostInt> boostValues(testNumberCount);
+	for (int i = 0; i < testNumberCount; i++) {
+		// Different amounts of words, so that both the basic and Karatsuba multiplication are used
+		std::vector<uint32_t> words = genMultipleUint32(randState + i, 1 + rnd64(randState) % wordCount);
+		randState++;
+		values[i].importBits(words);
+		boost::multiprecision::import_bits(boostValues[i], words.rbegin(), words.rend(), 32);
+		boostValues[i] %= bitLimiter;
+	}
+	for (int i = 0; i < testNumberCount; i++) {
+		int j = (i * 7 + 3) % testNumberCount;
+		int_limited_view A = values[i].view();
+		int_limited_view B = values[j].view();
+		boostInt& a = boostValues[i];
+		boostInt& b = boostValues[j];
+
+		int start = rnd64(randState) % bitSize;
+		int length = rnd64(randState + 1) % 65;
+		int sliceStart = rnd64(randState + 2) % wordCount;
+		randState += 3;
+		uint_limited<bitSize> sum = values[i];
+		sum += B;
+		uint_limited<bitSize> difference = values[i];
+		difference -= B;
+		if (A.bitLength() != (a == 0 ? 0 : int(boost::multiprecision::msb(a)) + 1)
+			|| A.extractBits(start, length) != uint64_t((a >> start) & ((boostInt(1) << length) - 1))
+			|| !uint_limitedEqualBoost(uint_limited<bitSize>(A.slice(sliceStart, 2)), (a >> (32*sliceStart)) & ((boostInt(1) << 64) - 1))
+			|| !uint_limitedEqualBoost(uint_limited<bitSize>::multiply(A, B), a * b % bitLimiter)
+			|| !uint_limitedEqualBoost(uint_limited<bitSize>::multiply(A.slice(sliceStart), B), (a >> (32*sliceStart)) * b % bitLimiter)
+			|| !uint_limitedEqualBoost(sum, (a + b) % bitLimiter)
+			|| !uint_limitedEqualBoost(difference, (a - b + bitLimiter) % bitLimiter)
+			|| (A <=> B) != (a.compare(b) <=> 0)) {
+			std::cout << "\033[1;31mFAILED: " << a << " and " << b << "\033[0m" << std::endl;
+			return false;
+		}
+	}
+	std::cout << "\033[32mPASSED VIEWS\033[0m" << std::endl;
+	return true;
+}
+
+// Conversions to int128 keep (or sign extend) the lower bits, so the printed values have to match, even for smaller bit sizes
+template <int bitSize>
+bool verifyInt128Interop(int testNumberCount = 1000, uint64_t randState = 1) {
+	std::cout << "VERIFYING INT128 INTEROP OF " << int_limited<bitSize>::className() << ": ";
+	typedef number_traits<int_limited<bitSize>> traits;
+	for (int i = 0; i < testNumberCount; i++) {
+		std::vector<uint32_t> words = genMultipleUint32(randState + i, 4);
+		randState++;
+		int128 value((uint64_t(words[3]) << 32) | words[2], (uint64_t(words[1]) << 32) | words[0]);
+		if (i % 3 == 0) value = -(value >> (i % 128));
+		int_limited<bitSize> converted = value;
+		uint_limited<bitSize> convertedUnsigned = uint128(value);
+		std::array<uint64_t, 2> halves = {number_traits<int128>::limb(value, 0), number_traits<int128>::limb(value, 1)};
+		std::vector<uint32_t> limbs(traits::limbCount);
+		for (int j = 0; j < traits::limbCount; j++) limbs[j] = traits::limb(converted, j);
+
+		bool passed = int128(converted).toString() == converted.toString() && uint128(convertedUnsigned).toString() == convertedUnsigned.toString()
+			&& number_traits<int128>::fromLimbs(halves) == value && traits::fromLimbs(limbs) == converted;
+		if constexpr (bitSize >= 128) {
+			passed = passed && converted.toString() == value.toString() && int128(converted) == value && uint128(convertedUnsigned) == uint128(value)
+				&& traits::limb(converted, 2) == uint32_t(halves[1]) && traits::limb(converted, 3) == uint32_t(halves[1] >> 32);
+		}
+		if (!passed) {
+			std::cout << "\033[1;31mFAILED: " << value << "\033[0m" << std::endl;
+			return false;
+		}
+	}
+	std::cout << "\033[32mPASSED INT128 INTEROP\033[0m" << std::endl;
+	return true;
+}
+
+// The signed test numbers never overflow (they are shifted right by 1), so they can be compared directly
+// Equal values also have to hash to the same value, which is checked by counting the unique values in a hash set
+template <int bitSize>
+bool verifyComparisonAndHash(int testNumberCount = 1000, uint64_t randState = 1) {
+	std::cout << "====================================================================================================" << std::endl;
+	std::cout << "VERIFYING COMPARISONS AND HASHING OF " << int_limited<bitSize>::className() << " WITH BOOST cpp_int" << std::endl;
+	std::cout << "====================================================================================================" << std::endl;
+
+	std::vector<boostInt> testNumbersBoost = generateBoostIntegers(testNumberCount, bitSize, randState);
+	std::vector<int_limited<bitSize>> testNumbersInt_limited = generateInt_limited<bitSize>(testNumberCount, randState);
+
+	std::cout << "VERIFYING THREE-WAY COMPARISON: ";
+	for (int i = 0; i < testNumberCount; i++) {
+		for (int j = 0; j < testNumberCount; j++) {
+			boostInt& a = testNumbersBoost[i];
+			boostInt& b = testNumbersBoost[j];
+			std::strong_ordering boostOrder = a.compare(b) <=> 0;
+			std::strong_ordering boostAbsOrder = boostInt(abs(a)).compare(boostInt(abs(b))) <=> 0;
+			if ((testNumbersInt_limited[i] <=> testNumbersInt_limited[j]) != boostOrder
+				|| testNumbersInt_limited[i].compareAbs(testNumbersInt_limited[j]) != boostAbsOrder) {
+				std::cout << "\033[1;31mFAILED: " << a << " <=> " << b << "\033[0m" << std::endl;
+				return false;
+			}
+		}
+	}
+	std::cout << "\033[32mPASSED THREE-WAY COMPARISON\033[0m" << std::endl;
+
+	std::cout << "VERIFYING HASHING: ";
+	std::unordered_set<int_limited<bitSize>> uniqueInt_limited(testNumbersInt_limited.begin(), testNumbersInt_limited.end());
+	std::sort(testNumbersBoost.begin(), testNumbersBoost.end());
+	int uniqueBoostCount = std::unique(testNumbersBoost.begin(), testNumbersBoost.end()) - testNumbersBoost.begin();
+	if (uniqueInt_limited.size() != uniqueBoostCount) {
+		std::cout << "\033[1;31mFAILED: " << uniqueInt_limited.size() << " unique values instead of " << uniqueBoostCount << "\033[0m" << std::endl;
+		return false;
+	}
+	std::cout << "\033[32mPASSED HASHING\033[0m" << std::endl;
+	return true;
+}
+
+// Boost only prints non-negative values in hexadecimal, so the sign is added manually
+template <int bitSize>
+bool verifyToString(int testNumberCount = 1000, uint64_t randState = 1) {
+	std::cout << "====================================================================================================" << std::endl;
+	std::cout << "VERIFYING STRING CONVERSION OF " << int_limited<bitSize>::className() << " WITH BOOST cpp_int" << std::endl;
+	std::cout << "====================================================================================================" << std::endl;
+
+	std::vector<boostInt> testNumbersBoost = generateBoostIntegers(testNumberCount, bitSize, randState);
+	std::vector<int_limited<bitSize>> testNumbersInt_limited = generateInt_limited<bitSize>(testNumberCount, randState);
+
+	std::cout << "VERIFYING TOSTRING AND PARSING: ";
+	for (int i = 0; i < testNumberCount; i++) {
+		boostInt& a = testNumbersBoost[i];
+		std::string boostHex = (a < 0 ? "-" : "") + boostInt(abs(a)).str(0, std::ios_base::hex | std::ios_base::uppercase);
+		// from_chars with the base detected from the prefix
+		std::string prefixedHex = (a < 0 ? "-0x" : "0x") + boostHex.substr(a < 0);
+		int_limited<bitSize> parsedHex;
+		std::from_chars_result result = from_chars(prefixedHex.data(), prefixedHex.data() + prefixedHex.size(), parsedHex, 0);
+		// to_chars into a buffer of exactly maxDigits() characters (octal digits span two words)
+		std::string boostOct = (a < 0 ? "-" : "") + boostInt(abs(a)).str(0, std::ios_base::oct);
+		std::array<char, int_limited<bitSize>::maxDigits(8)> buffer;
+		std::to_chars_result written = to_chars(buffer.data(), buffer.data() + buffer.size(), testNumbersInt_limited[i], 8);
+		if (written.ec != std::errc() || std::string(buffer.data(), written.ptr) != boostOct
+			|| to_chars(buffer.data(), buffer.data() + boostOct.size() - 1, testNumbersInt_limited[i], 8).ec != std::errc::value_too_large) {
+			std::cout << "\033[1;31mFAILED: to_chars " << a << "\033[0m" << std::endl;
+			return false;
+		}
+		// to_chars into a buffer of exactly (and one less than) the length of the decimal string
+		std::string boostDec = a.str();
+		std::string decimal(boostDec.size(), '#');
+		written = to_chars(decimal.data(), decimal.data() + decimal.size(), testNumbersInt_limited[i]);
+		if (written.ec != std::errc() || written.ptr != decimal.data() + decimal.size() || decimal != boostDec
+			|| to_chars(decimal.data(), decimal.data() + decimal.size() - 1, testNumbersInt_limited[i]).ec != std::errc::value_too_large) {
+			std::cout << "\033[1;31mFAILED: to_chars " << a << "\033[0m" << std::endl;
+			return false;
+		}
+		if (testNumbersInt_limited[i].toString() != a.str() || testNumbersInt_limited[i].toString(16) != boostHex
+			|| int_limited<bitSize>(a.str()) != testNumbersInt_limited[i]
+			|| result.ec != std::errc() || result.ptr != prefixedHex.data() + prefixedHex.size() || parsedHex != testNumbersInt_limited[i]) {
+			std::cout << "\033[1;31mFAILED: " << a << " (" << testNumbersInt_limited[i].toString() << ")\033[0m" << std::endl;
+			return false;
+		}
+	}
+	if (int_limited<bitSize>::MIN_VALUE().toString() != "-" + (boostInt(1) << (bitSize-1)).str()) {
+		std::cout << "\033[1;31mFAILED: MIN_VALUE (" << int_limited<bitSize>::MIN_VALUE() << ")\033[0m" << std::endl;
+		return false;
+	}
+	// from_chars reports errors instead of throwing
+	std::string tooLarge = (boostInt(1) << (bitSize-1)).str();
+	std::string minValue = "-" + tooLarge;
+	int_limited<bitSize> parsed = 17;
+	if (from_chars(tooLarge.data(), tooLarge.data() + tooLarge.size(), parsed).ec != std::errc::result_out_of_range
+		|| from_chars(minValue.data(), minValue.data() + minValue.size(), parsed).ec != std::errc()
+		|| parsed != int_limited<bitSize>::MIN_VALUE()
+		|| from_chars(minValue.data(), minValue.data() + 1, parsed).ec != std::errc::invalid_argument) {
+		std::cout << "\033[1;31mFAILED: from_chars error codes\033[0m" << std::endl;
+		return false;
+	}
+	// Writing to a stream, with and without padding to its width
+	for (int i = 0; i < testNumberCount; i++) {
+		std::string decimal = testNumbersBoost[i].str();
+		std::stringstream printed;
+		printed << testNumbersInt_limited[i] << " " << std::setw(decimal.size() + 2) << testNumbersInt_limited[i]
+			<< " " << std::left << std::setfill('*') << std::setw(decimal.size() + 1) << testNumbersInt_limited[i];
+		if (printed.str() != decimal + "   " + decimal + " " + decimal + "*") {
+			std::cout << "\033[1;31mFAILED: << " << testNumbersBoost[i] << " (" << printed.str() << ")\033[0m" << std::endl;
+			return false;
+		}
+	}
+	// Reading back from a stream, in decimal and with the base detected from the prefix
+	std::stringstream stream;
+	for (int i = 0; i < testNumberCount; i++) {
+		boostInt& a = testNumbersBoost[i];
+		stream << a << (i % 2 ? " " : "\n\t") << (a < 0 ? "-0x" : "+0x") << boostInt(abs(a)).str(0, std::ios_base::hex) << " ";
+	}
+	stream.unsetf(std::ios_base::basefield);
+	for (int i = 0; i < testNumberCount; i++) {
+		int_limited<bitSize> decimal, hex;
+		if (!(stream >> decimal >> hex) || decimal != testNumbersInt_limited[i] || hex != testNumbersInt_limited[i]) {
+			std::cout << "\033[1;31mFAILED: >> " << testNumbersBoost[i] << " (" << decimal << ", " << hex << ")\033[0m" << std::endl;
+			return false;
+		}
+	}
+	std::stringstream invalidStream(tooLarge + " " + minValue + " 0x 0");
+	if (!(invalidStream >> parsed).fail() || parsed != int_limited<bitSize>::MAX_VALUE()) {
+		std::cout << "\033[1;31mFAILED: >> out of range\033[0m" << std::endl;
+		return false;
+	}
+	invalidStream.clear();
+	if (!(invalidStream >> parsed) || parsed != int_limited<bitSize>::MIN_VALUE()
+		|| !(invalidStream >> std::hex >> parsed).fail() || parsed != 0
+		|| !(invalidStream.clear(), invalidStream >> parsed) || !invalidStream.eof()) {
+		std::cout << "\033[1;31mFAILED: >> error handling\033[0m" << std::endl;
+		return false;
+	}
+	std::cout << "\033[32mPASSED TOSTRING AND PARSING\033[0m" << std::endl;
+	return true;
+}
+
+// Round trips the values through both binary formats (and a memory mapped file)
+template <int bitSize>
+bool verifySerialization(int testNumberCount = 1000, uint64_t randState = 1) {
+	std::cout << "====================================================================================================" << std::endl;
+	std::cout << "VERIFYING BINARY SERIALIZATION OF " << int_limited<bitSize>::className() << std::endl;
+	std::cout << "====================================================================================================" << std::endl;
+
+	std::vector<int_limited<bitSize>> testNumbersInt_limited = generateInt_limited<bitSize>(testNumberCount, randState);
+	testNumbersInt_limited.push_back(int_limited<bitSize>::MIN_VALUE());
+	testNumbersInt_limited.push_back(0);
+
+	std::cout << "VERIFYING FIXED WIDTH ARRAYS: ";
+	const std::string path = "serialization-test.bin";
+	{
+		std::ofstream file(path, std::ios::binary);
+		writeArray(file, testNumbersInt_limited);
+	}
+	std::ifstream file(path, std::ios::binary);
+	std::vector<int_limited<bitSize>> parsed = readArray<bitSize>(file);
+	MappedArray<bitSize> mapped(path);
+	if (parsed != testNumbersInt_limited || mapped.size() != testNumbersInt_limited.size()) {
+		std::cout << "\033[1;31mFAILED: array of " << parsed.size() << " values\033[0m" << std::endl;
+		return false;
+	}
+	for (std::size_t i = 0; i < mapped.size(); i++) {
+		if (mapped[i] != testNumbersInt_limited[i] || mapped.view(i) != testNumbersInt_limited[i].view()) {
+			std::cout << "\033[1;31mFAILED: mapped " << testNumbersInt_limited[i] << " (" << mapped[i] << ")\033[0m" << std::endl;
+			return false;
+		}
+	}
+	std::remove(path.c_str());
+	// A flipped bit in the records has to be caught by the checksum
+	std::stringstream corrupted;
+	writeArray(corrupted, testNumbersInt_limited);
+	std::string bytes = corrupted.str();
+	bytes[ARRAY_HEADER_SIZE] ^= 1;
+	corrupted.str(bytes);
+	try {
+		readArray<bitSize>(corrupted);
+		std::cout << "\033[1;31mFAILED: corrupted array was accepted\033[0m" << std::endl;
+		return false;
+	} catch (std::domain_error const&) {}
+	std::cout << "\033[32mPASSED FIXED WIDTH ARRAYS\033[0m" << std::endl;
+
+	std::cout << "VERIFYING VARIABLE WIDTH VALUES: ";
+	std::vector<uint8_t> encoded;
+	for (int_limited<bitSize> const& value : testNumbersInt_limited) {
+		appendVariable(encoded, value);
+		appendVariable(encoded, value >> (bitSize/2));
+	}
+	const uint8_t* cur = encoded.data();
+	for (int_limited<bitSize> const& value : testNumbersInt_limited) {
+		int_limited<bitSize> full, shifted;
+		cur = readVariable(cur, encoded.data() + encoded.size(), full);
+		cur = readVariable(cur, encoded.data() + encoded.size(), shifted);
+		if (full != value || shifted != (value >> (bitSize/2))) {
+			std::cout << "\033[1;31mFAILED: " << value << " (" << full << ")\033[0m" << std::endl;
+			return false;
+		}
+	}
+	// The magnitude of the minimum value doesn't fit into a smaller type
+	std::vector<uint8_t> minValue;
+	appendVariable(minValue, int_limited<bitSize>::MIN_VALUE());
+	int_limited<bitSize - 1> smaller;
+	try {
+		readVariable(minValue.data(), minValue.data() + minValue.size(), smaller);
+		std::cout << "\033[1;31mFAILED: out of range value was accepted\033[0m" << std::endl;
+		return false;
+	} catch (std::range_error const&) {}
+	if (cur != encoded.data() + encoded.size()) {
+		std::cout << "\033[1;31mFAILED: " << encoded.data() + encoded.size() - cur << " bytes left over\033[0m" << std::endl;
+		return false;
+	}
+	std::cout << "\033[32mPASSED VARIABLE WIDTH VALUES\033[0m" << std::endl;
+	return true;
+}
+
+// The limb overloads are constexpr, so a small context can be checked at compile time (2^64 - 59 is prime)
+typedef MontgomeryContext<64>::limbArray limbs64;
+constexpr MontgomeryContext<64> montgomery64(limbs64{0xFFFFFFFFFFFFFFC5});
+static_assert(montgomery64.fromMont(montgomery64.mul(montgomery64.toMont(limbs64{3}), montgomery64.toMont(limbs64{5})))[0] == 15);
+static_assert(montgomery64.fromMont(montgomery64.one())[0] == 1);
+
+// Random odd moduli of different lengths, every operation is compared with the same operation in boost followed by %
+template <int bitSize>
+bool verifyMontgomery(int testNumberCount = 1000, uint64_t randState = 1) {
+	std::cout << "VERIFYING MONTGOMERY MULTIPLICATION OF " << uint_limited<bitSize>::className() << ": ";
+	constexpr int wordCount = bitSize/32 + (bitSize%32 > 0);
+	boostInt bitLimiter = boostInt(1) << bitSize;
+	for (int i = 0; i < testNumberCount; i++) {
+		std::array<uint_limited<bitSize>, 3> values;
+		std::array<boostInt, 3> boostValues;
+		for (int j = 0; j < 3; j++) {
+			std::vector<uint32_t> words = genMultipleUint32(randState, 1 + rnd64(randState) % wordCount);
+			randState += words.size();
+			values[j].importBits(words);
+			boost::multiprecision::import_bits(boostValues[j], words.rbegin(), words.rend(), 32);
+			boostValues[j] %= bitLimiter;
+		}
+		values[0] |= 1;
+		boostValues[0] |= 1;
+		if (boostValues[0] < 3) continue;
+		uint_limited<bitSize> const& N = values[0];
+		boostInt const& n = boostValues[0];
+		boostInt a = boostValues[1] % n;
+		boostInt const& b = boostValues[2];
+
+		MontgomeryContext<bitSize> context(N);
+		uint_limited<bitSize> montA = context.toMont(values[1]);
+		uint_limited<bitSize> montB = context.toMont(values[2]);
+		if (!uint_limitedEqualBoost(context.fromMont(montA), a)
+			|| !uint_limitedEqualBoost(context.fromMont(context.mul(montA, montB)), a * b % n)
+			|| !uint_limitedEqualBoost(context.fromMont(context.sqr(montA)), a * a % n)
+			|| !uint_limitedEqualBoost(context.powMod(values[1], values[2]), boost::multiprecision::powm(a, b, n))
+			|| !uint_limitedEqualBoost(context.powMod(values[1], uint64_t(i)), boost::multiprecision::powm(a, i, n))) {
+			std::cout << "\033[1;31mFAILED: " << a << " and " << b << " modulo " << n << "\033[0m" << std::endl;
+			return false;
+		}
+	}
+	try {
+		MontgomeryContext<bitSize> context(uint_limited<bitSize>(4));
+		std::cout << "\033[1;31mFAILED: even modulus was accepted\033[0m" << std::endl;
+		return false;
+	} catch (std::domain_error const&) {}
+	std::cout << "\033[32mPASSED MONTGOMERY MULTIPLICATION\033[0m" << std::endl;
+	return true;
+}
+
+// Any moduli (also even ones and powers of 2^64, for which mu has an extra limb), compared with % of the double width value
+template <int bitSize>
+bool verifyBarrett(int testNumberCount = 1000, uint64_t randState = 1) {
+	std::cout << "VERIFYING BARRETT REDUCTION OF " << uint_limited<bitSize>::className() << ": ";
+	constexpr int wordCount = bitSize/32 + (bitSize%32 > 0);
+	for (int i = 0; i < testNumberCount; i++) {
+		std::array<uint_limited<bitSize>, 3> values;
+		for (int j = 0; j < 3; j++) {
+			std::vector<uint32_t> words = genMultipleUint32(randState, 1 + rnd64(randState) % wordCount);
+			randState += words.size();
+			values[j].importBits(words);
+		}
+		uint_limited<bitSize> N = values[0];
+		if (i % 10 == 0) N = uint_limited<bitSize>(1) << (64 * (i % (bitSize/64 + (bitSize%64 > 0))));
+		if (N == 0) continue;
+		uint_limited<2*bitSize> wideN = N;
+		uint_limited<bitSize> a = values[1] % N;
+		uint_limited<bitSize> b = values[2] % N;
+		// Unreduced, so that values with more than twice the limbs of a small modulus are also reduced
+		uint_limited<2*bitSize> product = uint_limited<2*bitSize>::multiply(values[1].view(), values[2].view());
+
+		BarrettContext<bitSize> context(N);
+		uint_limited<bitSize> reduced = values[1];
+		reduced %= context;
+		if (product % context != uint_limited<bitSize>(product % wideN)
+			|| context.mulMod(a, b) != uint_limited<bitSize>(uint_limited<2*bitSize>::multiply(a.view(), b.view()) % wideN)
+			|| context.sqrMod(a) != uint_limited<bitSize>(uint_limited<2*bitSize>::multiply(a.view(), a.view()) % wideN)
+			|| reduced != a || values[2] % context != b) {
+			std::cout << "\033[1;31mFAILED: " << values[1] << " and " << values[2] << " modulo " << N << "\033[0m" << std::endl;
+			return false;
+		}
+	}
+	std::cout << "\033[32mPASSED BARRETT REDUCTION\033[0m" << std::endl;
+	return true;
+}
+
+// Compile time moduli: special forms (also an even one) and Montgomery forms, the inverse is only checked for primes
+constexpr auto prime64 = limbArithmetic::parse<64>("18446744073709551557"); // 2^64 - 59
+constexpr auto prime25519 = limbArithmetic::parse<256>("0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffed"); // 2^255 - 19
+constexpr auto primeP256 = limbArithmetic::parse<256>("0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff");
+constexpr auto evenSpecial = limbArithmetic::parse<128>("340282366920938463463374607431768211454"); // 2^128 - 2
+constexpr auto oddComposite = limbArithmetic::parse<130>("1234567890123456789012345678901234567");
+static_assert(mod_int<64, prime64>::isSpecialForm && mod_int<256, prime25519>::isSpecialForm && mod_int<128, evenSpecial>::isSpecialForm);
+static_assert(!mod_int<256, primeP256>::isSpecialForm && !mod_int<130, oddComposite>::isSpecialForm);
+static_assert((mod_int<64, prime64>(3) * mod_int<64, prime64>(5)).limbs()[0] == 15);
+static_assert(mod_int<64, prime64>(7).inverse() * 7 == 1);
+static_assert(mod_int<256, primeP256>(2).pow(256) - mod_int<256, primeP256>(2).pow(224) + mod_int<256, primeP256>(2).pow(192) + mod_int<256, primeP256>(2).pow(96) == 1);
+
+template <int bitSize, typename MontgomeryContext<bitSize>::limbArray Modulus>
+bool verifyModInt(bool isPrime, int testNumberCount = 1000, uint64_t randState = 1) {
+	typedef mod_int<bitSize, Modulus> modInt;
+	std::cout << "VERIFYING MOD_INT MODULO " << modInt::modulus() << ": ";
+	constexpr int wordCount = bitSize/32 + (bitSize%32 > 0);
+	boostInt bitLimiter = boostInt(1) << bitSize;
+	boostInt n = boostInt(modInt::modulus().toString());
+	for (int i = 0; i < testNumberCount; i++) {
+		std::array<uint_limited<bitSize>, 2> values;
+		std::array<boostInt, 2> boostValues;
+		for (int j = 0; j < 2; j++) {
+			std::vector<uint32_t> words = genMultipleUint32(randState, 1 + rnd64(randState) % wordCount);
+			randState += words.size();
+			values[j].importBits(words);
+			boost::multiprecision::import_bits(boostValues[j], words.rbegin(), words.rend(), 32);
+			boostValues[j] %= bitLimiter;
+		}
+		modInt a(values[0]);
+		modInt b(values[1]);
+		boostInt const& A = boostValues[0];
+		boostInt const& B = boostValues[1];
+		uint64_t exp = rnd64(randState++);
+		if (!uint_limitedEqualBoost(a.value(), A % n)
+			|| !uint_limitedEqualBoost((a + b).value(), (A + B) % n)
+			|| !uint_limitedEqualBoost((a - b).value(), ((A - B) % n + n) % n)
+			|| !uint_limitedEqualBoost((a * b).value(), A * B % n)
+			|| !uint_limitedEqualBoost(a.pow(exp).value(), boost::multiprecision::powm(A, exp, n))
+			|| !uint_limitedEqualBoost(a.pow(values[1]).value(), boost::multiprecision::powm(A, B, n))
+			|| (isPrime && a != 0 && a * a.inverse() != 1)) {
+			std::cout << "\033[1;31mFAILED: " << A << " and " << B << "\033[0m" << std::endl;
+			return false;
+		}
+	}
+	std::cout << "\033[32mPASSED MOD_INT\033[0m" << std::endl;
+	return true;
+}
+
 int main() {
 	int testCaseAmount = 1000;
 	uint64_t randState = 1;
@@ -317,5 +921,52 @@ int main() {
 	testCaseAmount = 20;
 	verifyCorrectnessOfInt_limited<32*2048>(testCaseAmount, randState); // 65536
 
+	testCaseAmount = 400;
+	verifyCorrectnessOfUint_limited<32*2 + 1>(testCaseAmount, randState);
+	verifyCorrectnessOfUint_limited<32*8>(testCaseAmount, randState);
+	verifyCorrectnessOfUint_limited<32*32 + 31>(testCaseAmount, randState); // 1055
+
+	verifyZeroLowWord<32*4>();
+	verifyZeroLowWord<32*8>();
+	verifyZeroLowWord<32*32 + 31>(); // 1055
+
+	verifyBitImportExport<16>(testCaseAmount, randState);
+	verifyBitImportExport<32*4 + 2>(testCaseAmount, randState);
+	verifyBitImportExport<32*32 + 31>(testCaseAmount, randState);
+
+	verifyView<32*4 + 2>(testCaseAmount, randState);
+	verifyView<32*32 + 31>(testCaseAmount, randState);
+	verifyView<32*128 + 63>(testCaseAmount, randState); // 4159
+
+	verifyInt128Interop<32*2 + 1>(testCaseAmount, randState);
+	verifyInt128Interop<32*4>(testCaseAmount, randState);
+	verifyInt128Interop<32*8 + 6>(testCaseAmount, randState);
+
+	verifyComparisonAndHash<32*2 + 1>(testCaseAmount, randState);
+	verifyComparisonAndHash<32*32 + 31>(testCaseAmount, randState);
+
+	verifyToString<32*2 + 1>(testCaseAmount, randState);
+	verifyToString<32*32 + 31>(testCaseAmount, randState);
+	testCaseAmount = 100;
+	verifyToString<32*128 + 63>(testCaseAmount, randState); // 4159
+	verifyToString<32*1024>(testCaseAmount, randState); // 32768
+
+	testCaseAmount = 400;
+	verifySerialization<32*2 + 1>(testCaseAmount, randState);
+	verifySerialization<32*32 + 31>(testCaseAmount, randState);
+
+	verifyMontgomery<32*2 + 1>(testCaseAmount, randState);
+	verifyMontgomery<32*8>(testCaseAmount, randState);
+	testCaseAmount = 100;
+	verifyMontgomery<32*32 + 31>(testCaseAmount, randState); // 1055
+	verifyBarrett<32*2 + 1>(testCaseAmount, randState);
+	verifyBarrett<32*8>(testCaseAmount, randState);
+	verifyBarrett<32*32 + 31>(testCaseAmount, randState); // 1055
+	verifyModInt<64, prime64>(true, testCaseAmount, randState);
+	verifyModInt<256, prime25519>(true, testCaseAmount, randState);
+	verifyModInt<256, primeP256>(true, testCaseAmount, randState);
+	verifyModInt<128, evenSpecial>(false, testCaseAmount, randState);
+	verifyModInt<130, oddComposite>(false, testCaseAmount, randState);
+
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,861 @@
+#pragma once
+#include "constants.hpp"
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <charconv>
+#include <system_error>
+#include <compare>
+#include <functional>
+#include <utility>
+#include <bit>
+#include <type_traits>
+#include <algorithm>
+#include <cmath>
+
+namespace largeNumberLibrary {
+	// Unsigned counterpart of int128, all arithmetic is modulo 2^128
+	class uint128 {
+		private:
+			// byte/word 0 and 1
+			uint64_t B0;
+			uint64_t B1;
+
+			// Divides the 128 bit value (high, low) by divisor and returns the quotient
+			// Expects high < divisor, so that the quotient fits into 64 bits
+			// On x86-64 this is a single divq instruction (except during constant evaluation)
+			// otherwise the portable version from Hacker's Delight (divlu) is used
+			// which normalizes the divisor and estimates each 32 bit half of the quotient with a 64/32 division
+			static constexpr uint64_t divide128By64(uint64_t high, uint64_t low, uint64_t divisor, uint64_t& remainder) noexcept {
+				#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+				if (!std::is_constant_evaluated()) {
+					uint64_t quotient;
+					__asm__("divq %[divisor]" : "=a"(quotient), "=d"(remainder) : [divisor] "rm"(divisor), "a"(low), "d"(high));
+					return quotient;
+				}
+				#endif
+				int shift = std::countl_zero(divisor);
+				divisor <<= shift;
+				if (shift != 0) high = (high << shift) | (low >> (64 - shift));
+				low <<= shift;
+
+				uint64_t divisorHigh = divisor >> 32;
+				uint64_t divisorLow = divisor & UINT32_MAX;
+				uint64_t lowHigh = low >> 32;
+				uint64_t lowLow = low & UINT32_MAX;
+
+				// The estimate is at most 2 too large
+				uint64_t quotientHigh = high / divisorHigh;
+				uint64_t rem = high - quotientHigh * divisorHigh;
+				while (quotientHigh > UINT32_MAX || quotientHigh * divisorLow > ((rem << 32) | lowHigh)) {
+					quotientHigh--;
+					rem += divisorHigh;
+					if (rem > UINT32_MAX) break;
+				}
+				// Wraps around correctly, since the true value fits into 64 bits
+				uint64_t middle = (high << 32) + lowHigh - quotientHigh * divisor;
+
+				uint64_t quotientLow = middle / divisorHigh;
+				rem = middle - quotientLow * divisorHigh;
+				while (quotientLow > UINT32_MAX || quotientLow * divisorLow > ((rem << 32) | lowLow)) {
+					quotientLow--;
+					rem += divisorHigh;
+					if (rem > UINT32_MAX) break;
+				}
+				remainder = ((middle << 32) + lowLow - quotientLow * divisor) >> shift;
+				return (quotientHigh << 32) | quotientLow;
+			}
+
+			// Multiplies the value by a word and adds another word to it, returns whether the result overflowed
+			static constexpr bool multiplyAddWord(uint128& value, uint64_t multiplier, uint64_t addend) noexcept {
+				uint128 highProduct = uint128(value.B1) * uint128(multiplier);
+				uint128 lowProduct = uint128(value.B0) * uint128(multiplier) + uint128(addend);
+				value = uint128(highProduct.B0, 0) + lowProduct;
+				return highProduct.B1 != 0 || value.B1 < highProduct.B0;
+			}
+
+			// Returns the largest power of the base that fits into a word (and sets chunkDigits to its exponent)
+			static constexpr uint64_t radixChunk(uint64_t base, int& chunkDigits) noexcept {
+				if (base == 10) {
+					chunkDigits = 19;
+					return 10000000000000000000ULL;
+				}
+				const uint64_t limit = UINT64_MAX / base;
+				uint64_t chunkBase = base;
+				chunkDigits = 1;
+				while (chunkBase <= limit) {
+					chunkBase *= base;
+					chunkDigits++;
+				}
+				return chunkBase;
+			}
+
+			// Writes the digits of the word in front of end (least significant first) and returns the new start
+			// At least minDigits digits are written, so that chunks other than the most significant one are padded with zeroes
+			static constexpr char* writeWordDigits(char* end, uint64_t word, uint64_t base, int minDigits) noexcept {
+				// A constant divisor allows the compiler to replace the division with a multiplication
+				// and base 10 writes two digits per division
+				if (base == 10) {
+					while (word >= 100 || minDigits > 2) {
+						uint64_t pair = word % 100;
+						word /= 100;
+						end -= 2;
+						end[0] = DECIMAL_DIGIT_PAIRS[2*pair];
+						end[1] = DECIMAL_DIGIT_PAIRS[2*pair + 1];
+						minDigits -= 2;
+					}
+					if (word >= 10 || minDigits == 2) {
+						end -= 2;
+						end[0] = DECIMAL_DIGIT_PAIRS[2*word];
+						end[1] = DECIMAL_DIGIT_PAIRS[2*word + 1];
+					} else {
+						*--end = char('0' + word);
+					}
+				} else {
+					do {
+						*--end = DIGIT_CHARS[word % base];
+						word /= base;
+					} while (--minDigits > 0 || word != 0);
+				}
+				return end;
+			}
+
+			static constexpr int countTrailingZeroes(uint128 const& value) noexcept {
+				if (value.B0 != 0) return std::countr_zero(value.B0);
+				return 64 + std::countr_zero(value.B1);
+			}
+
+		public:
+			/*
+			SECTION: CONSTRUCTION
+			=============================================================
+			default constructor DONE
+			base constructor DONE
+			IMPLICIT conversion FROM:
+				uint64_t DONE
+				int64_t DONE
+				int DONE
+				uint DONE
+			>> (extraction from stream) DONE
+			from_chars DONE
+			conversion TO:
+				uint64_t DONE
+				int64_t DONE
+				int DONE
+				uint DONE
+				char DONE
+			conversion FROM and TO int128 (explicit, in int128.hpp) DONE
+			= (assignment operator, defaulted) DONE
+			=============================================================
+			*/
+			#pragma region Construction
+
+
+			constexpr uint128() noexcept : B0(0), B1(0) {}
+			// Accepts most significant word first
+			constexpr uint128(uint64_t a, uint64_t b) noexcept {
+				B1 = a;
+				B0 = b;
+			}
+			constexpr uint128(uint64_t a) noexcept {
+				B1 = 0;
+				B0 = a;
+			}
+			// Negative values wrap around (sign extension), the same as converting an int64_t to a uint64_t
+			constexpr uint128(int64_t a) noexcept {
+				if (a < 0) {
+					B1 = UINT64_MAX;
+				} else {
+					B1 = 0;
+				}
+				B0 = a;
+			}
+			constexpr uint128(int a) noexcept {
+				if (a < 0) {
+					B1 = UINT64_MAX;
+				} else {
+					B1 = 0;
+				}
+				B0 = a;
+			}
+			constexpr uint128(unsigned int a) noexcept {
+				B1 = 0;
+				B0 = a;
+			}
+			constexpr uint128(const char* s) {
+				B1 = 0;
+				B0 = 0;
+				// Up to 19 digits are accumulated in a single word, before multiplying the whole value
+				while (*s != '\0') {
+					uint64_t chunk = 0;
+					uint64_t multiplier = 1;
+					for (int digit = 0; digit < 19 && *s != '\0'; digit++, s++) {
+						const char c = *s;
+						if (c < '0' || c > '9') throw std::domain_error("String to uint128 conversion exception");
+						chunk = chunk*10 + (c-'0');
+						multiplier *= 10;
+					}
+					*this = *this * uint128(multiplier) + uint128(chunk);
+				}
+			}
+
+			// Reads a number straight from the stream buffer, without building an intermediate string
+			// Leading whitespace is skipped (unless std::noskipws is set), then an optional '+' (a '-' is not accepted)
+			// The base is taken from the stream's basefield (std::dec, std::hex, std::oct)
+			// With std::hex a "0x" prefix is also accepted, and if basefield is unset
+			// the base is detected from a "0x", "0o" or "0b" prefix (otherwise base 10)
+			// If there are no digits, num is set to 0, if the value doesn't fit, it is set to the maximum value
+			// In both cases failbit is set (same as for the standard integer types)
+			friend std::istream& operator>>(std::istream& is, uint128& num) {
+				std::istream::sentry sentry(is);
+				if (!sentry) return is;
+				std::streambuf* buffer = is.rdbuf();
+				std::ios_base::iostate state = std::ios_base::goodbit;
+				const int eof = std::char_traits<char>::eof();
+
+				int c = buffer->sgetc();
+				if (c == '+') c = buffer->snextc();
+				int base = 0;
+				switch (is.flags() & std::ios_base::basefield) {
+					case std::ios_base::dec: base = 10; break;
+					case std::ios_base::hex: base = 16; break;
+					case std::ios_base::oct: base = 8; break;
+				}
+				bool sawDigit = false;
+				if ((base == 0 || base == 16) && c == '0') {
+					// The zero is a valid number on its own, unless it is followed by a prefix letter
+					sawDigit = true;
+					c = buffer->snextc();
+					int prefixBase = 0;
+					if (c == 'x' || c == 'X') prefixBase = 16;
+					else if (base == 0 && (c == 'o' || c == 'O')) prefixBase = 8;
+					else if (base == 0 && (c == 'b' || c == 'B')) prefixBase = 2;
+					if (prefixBase != 0) {
+						base = prefixBase;
+						sawDigit = false;
+						c = buffer->snextc();
+					}
+				}
+				if (base == 0) base = 10;
+
+				// Digits are accumulated into a single word before multiplying the whole value (e.g. 19 digits for base 10)
+				uint128 value;
+				bool overflow = false;
+				const uint64_t limit = UINT64_MAX / base;
+				while (true) {
+					uint64_t chunk = 0;
+					uint64_t multiplier = 1;
+					while (c != eof && multiplier <= limit) {
+						uint8_t digit = DIGIT_VALUES[uint8_t(c)];
+						if (digit >= base) break;
+						chunk = chunk*base + digit;
+						multiplier *= base;
+						c = buffer->snextc();
+					}
+					if (multiplier == 1) break;
+					sawDigit = true;
+					overflow |= multiplyAddWord(value, multiplier, chunk);
+				}
+				if (c == eof) state |= std::ios_base::eofbit;
+
+				if (!sawDigit) {
+					num = uint128();
+					state |= std::ios_base::failbit;
+				} else if (overflow) {
+					num = uint128(UINT64_MAX, UINT64_MAX);
+					state |= std::ios_base::failbit;
+				} else {
+					num = value;
+				}
+				is.setstate(state);
+				return is;
+			}
+
+			// Parses the longest valid number at the start of [first, last), in the style of std::from_chars
+			// Bases from 2 to 36 are accepted, base 0 detects the base from a "0x", "0o" or "0b" prefix (otherwise base 10)
+			// Instead of throwing, errors are returned in ec (invalid_argument if there are no digits,
+			// result_out_of_range if the value doesn't fit) and value is left unchanged
+			// ptr points to the first character which isn't a part of the number
+			// Digits are accumulated into a single word before multiplying the whole value (e.g. 19 digits for base 10)
+			friend constexpr std::from_chars_result from_chars(const char* first, const char* last, uint128& value, int base = 10) {
+				const char* cur = first;
+				if (base == 0) {
+					base = 10;
+					if (last - cur > 2 && cur[0] == '0') {
+						int prefixBase = 0;
+						if (cur[1] == 'x' || cur[1] == 'X') prefixBase = 16;
+						else if (cur[1] == 'o' || cur[1] == 'O') prefixBase = 8;
+						else if (cur[1] == 'b' || cur[1] == 'B') prefixBase = 2;
+						// Without a valid digit after it, the prefix is just a zero followed by a letter
+						if (prefixBase != 0 && DIGIT_VALUES[uint8_t(cur[2])] < prefixBase) {
+							base = prefixBase;
+							cur += 2;
+						}
+					}
+				}
+				if (base < 2 || base > 36) return {first, std::errc::invalid_argument};
+
+				const char* digitsStart = cur;
+				uint128 result;
+				bool overflow = false;
+				const uint64_t limit = UINT64_MAX / base;
+				while (cur != last) {
+					uint64_t chunk = 0;
+					uint64_t multiplier = 1;
+					while (cur != last && multiplier <= limit) {
+						uint8_t digit = DIGIT_VALUES[uint8_t(*cur)];
+						if (digit >= base) break;
+						chunk = chunk*base + digit;
+						multiplier *= base;
+						cur++;
+					}
+					if (multiplier == 1) break;
+					overflow |= multiplyAddWord(result, multiplier, chunk);
+				}
+				if (cur == digitsStart) return {first, std::errc::invalid_argument};
+				if (overflow) return {cur, std::errc::result_out_of_range};
+				value = result;
+				return {cur, std::errc()};
+			}
+
+			// All explicit conversions simply returns the bits for the given bit amount
+			constexpr explicit operator uint64_t() const noexcept {
+				return B0;
+			}
+			constexpr explicit operator int64_t() const noexcept {
+				return (int64_t)B0;
+			}
+			constexpr explicit operator int() const noexcept {
+				return (int)B0;
+			}
+			constexpr explicit operator unsigned int() const noexcept {
+				return (unsigned int)B0;
+			}
+			constexpr explicit operator char() const noexcept {
+				return (char)B0;
+			}
+			#pragma endregion Construction
+
+			/*
+			SECTION: PRINTING
+			=============================================================
+			className DONE
+			maxDigits DONE
+			to_chars DONE
+			toString DONE
+			<< (insertion to stream) DONE
+			=============================================================
+			*/
+			#pragma region Printing
+
+			static std::string className() {
+				return "largeNumberLibrary::uint128";
+			}
+
+			// Returns the number of characters of the largest value in the base, so a buffer of this size is always large enough
+			static constexpr int maxDigits(uint64_t base = 10) {
+				if (base < 2) throw std::out_of_range("Unable to convert value to base " + std::to_string(base));
+				uint128 value(UINT64_MAX, UINT64_MAX);
+				int digits = 0;
+				do {
+					value /= base;
+					digits++;
+				} while (!!value);
+				return digits;
+			}
+
+			// Writes the value into [first, last) in the style of std::to_chars, without allocating
+			// Bases from 2 to 36 are accepted
+			// If the buffer is too small, then ec is std::errc::value_too_large and ptr is last
+			// The value is split into at most three chunks of the largest power of the base that fits into a word (e.g. 10^19)
+			// with 128/64 divisions, then the digits of every chunk are calculated with 64 bit divisions
+			friend constexpr std::to_chars_result to_chars(char* first, char* last, uint128 const& value, int base = 10) {
+				if (base < 2 || base > 36) return {last, std::errc::invalid_argument};
+				int chunkDigits;
+				uint64_t chunkBase = radixChunk(base, chunkDigits);
+				// The digits are written from the back of a buffer on the stack (least significant chunk first)
+				// Only the most significant chunk isn't padded with zeroes
+				char digits[128];
+				char* end = digits + 128;
+				char* start = end;
+				uint128 rest = value;
+				while (rest.B1 != 0 || rest.B0 >= chunkBase) {
+					std::pair<uint128, uint128> division = rest.divmod(chunkBase);
+					start = writeWordDigits(start, division.second.B0, base, chunkDigits);
+					rest = division.first;
+				}
+				start = writeWordDigits(start, rest.B0, base, 1);
+				if (last - first < end - start) return {last, std::errc::value_too_large};
+				return {std::copy(start, end, first), std::errc()};
+			}
+
+			// Returns a string of the current value converted to the desired base
+			// Base is limited to a single unsigned 64 bit integer
+			// Bases up to 36 are written with to_chars, larger bases write every digit in base 10 followed by '_'
+			std::string toString(uint64_t base = 10) const {
+				if (base < 2) throw std::out_of_range("Unable to convert value to base " + std::to_string(base));
+				if (base <= 36) {
+					// Base 2 has the most digits
+					char buffer[maxDigits(2)];
+					std::to_chars_result result = to_chars(buffer, buffer + sizeof(buffer), *this, base);
+					return std::string(buffer, result.ptr);
+				}
+				// The digits come out least significant first, so they are reversed at the end
+				std::string output = "";
+				uint128 num = *this;
+				do {
+					std::pair<uint128, uint128> division = num.divmod(base);
+					std::string word = std::to_string(division.second.B0);
+					num = division.first;
+					output += '_';
+					output.append(word.rbegin(), word.rend());
+				} while (!!num);
+				return std::string(output.rbegin(), output.rend());
+			}
+
+			// Writes the value in base 10 directly into the stream, from a buffer on the stack
+			friend std::ostream& operator<<(std::ostream& os, uint128 const& num) {
+				char buffer[maxDigits()];
+				std::to_chars_result result = to_chars(buffer, buffer + sizeof(buffer), num);
+				os << std::string_view(buffer, result.ptr - buffer);
+				return os;
+			}
+			#pragma endregion Printing
+
+
+			/*
+			SECTION: ARITHMETIC
+			=============================================================
+			+ (addition) DONE
+			- (subtraction) DONE
+			* (multiplication) DONE
+			/ (division) DONE
+			% (modulus) DONE
+			respective compound operators (+=, -=, *=, /=, %=) DONE
+			divmod DONE
+			=============================================================
+			*/
+			#pragma region Arithmetic
+
+			// The carry is simply whether the lower word wrapped around (add/adc on x86-64)
+			constexpr uint128& operator+=(uint128 const& rhs) noexcept {
+				B0 += rhs.B0;
+				B1 += rhs.B1 + (B0 < rhs.B0);
+				return *this;
+			}
+			constexpr uint128 operator+(uint128 const& rhs) const noexcept {
+				uint128 result(B1, B0);
+				return result += rhs;
+			}
+
+			// The borrow is whether the lower word wraps around (sub/sbb on x86-64)
+			constexpr uint128& operator-=(uint128 const& rhs) noexcept {
+				B1 -= rhs.B1 + (B0 < rhs.B0);
+				B0 -= rhs.B0;
+				return *this;
+			}
+			constexpr uint128 operator-(uint128 const& rhs) const noexcept {
+				uint128 result(B1, B0);
+				return result -= rhs;
+			}
+			// Returns 2^128 - value, the same as negating a standard unsigned integer
+			constexpr uint128 operator-() const noexcept {
+				return uint128(~B1 + (B0 == 0), ~B0 + 1);
+			}
+
+			// Only the product of the lower words needs the full 128 bits, the cross products only affect B1
+			// If the compiler has a native 128 bit type, the full product of the lower words is a single instruction (mul/mulx on x86-64)
+			// Otherwise the lower words are split into 32 bit halves (schoolbook multiplication)
+			constexpr uint128& operator*=(uint128 const& rhs) noexcept {
+				#if defined(__SIZEOF_INT128__)
+				unsigned __int128 lowProduct = (unsigned __int128)B0 * rhs.B0;
+				// We ignore B1*rhs.B1, because it completely overflows anyway
+				B1 = B1 * rhs.B0 + B0 * rhs.B1 + uint64_t(lowProduct >> 64);
+				B0 = uint64_t(lowProduct);
+				#else
+				uint64_t lowM = B0 & UINT32_MAX, highM = B0 >> 32;
+				uint64_t lowR = rhs.B0 & UINT32_MAX, highR = rhs.B0 >> 32;
+				uint64_t z0 = lowM * lowR;
+				uint64_t middle1 = highM * lowR + (z0 >> 32);
+				uint64_t middle2 = lowM * highR + (middle1 & UINT32_MAX);
+				// We ignore B1*rhs.B1, because it completely overflows anyway
+				B1 = B1 * rhs.B0 + B0 * rhs.B1 + highM * highR + (middle1 >> 32) + (middle2 >> 32);
+				B0 = (middle2 << 32) | (z0 & UINT32_MAX);
+				#endif
+				return *this;
+			}
+			constexpr uint128 operator*(uint128 const& rhs) const noexcept {
+				uint128 result(B1, B0);
+				return result *= rhs;
+			}
+
+			constexpr uint128& operator/=(uint128 const& divisor) {
+				*this = this->divmod(divisor).first;
+				return *this;
+			}
+			constexpr uint128 operator/(uint128 const& rhs) const {
+				uint128 result(B1, B0);
+				return result /= rhs;
+			}
+			constexpr uint128& operator%=(uint128 const& divisor) {
+				*this = this->divmod(divisor).second;
+				return *this;
+			}
+			constexpr uint128 operator%(uint128 const& rhs) const {
+				uint128 result(B1, B0);
+				return result %= rhs;
+			}
+			// Returns both the quotient and the remainder (the same as / and %) from a single division
+			// No temporary arrays are needed, since the quotient either needs two 128/64 divisions (64 bit divisor)
+			// or fits into a single word, which is estimated from the highest 64 bits of the normalized divisor
+			constexpr std::pair<uint128, uint128> divmod(uint128 const& divisor) const {
+				if (divisor.B1 == 0) {
+					if (divisor.B0 == 0) throw std::domain_error("Divide by zero exception");
+					if (B1 == 0) return {uint128(B0 / divisor.B0), uint128(B0 % divisor.B0)};
+					uint64_t quotientHigh = B1 / divisor.B0;
+					uint64_t rem;
+					uint64_t quotientLow = divide128By64(B1 % divisor.B0, B0, divisor.B0, rem);
+					return {uint128(quotientHigh, quotientLow), uint128(rem)};
+				}
+				if (*this < divisor) return {uint128(), *this};
+				// From Hacker's Delight (divlu64): the estimate from the normalized divisor is either correct or one too large
+				// The dividend is shifted right by one, so that the 128/64 division can't overflow
+				int shift = std::countl_zero(divisor.B1);
+				uint64_t normalized = shift == 0 ? divisor.B1 : (divisor.B1 << shift) | (divisor.B0 >> (64 - shift));
+				uint64_t rem;
+				uint64_t estimate = divide128By64(B1 >> 1, (B1 << 63) | (B0 >> 1), normalized, rem);
+				estimate >>= 63 - shift;
+				if (estimate != 0) estimate--;
+				uint128 remainder = *this - divisor * uint128(estimate);
+				if (remainder >= divisor) {
+					estimate++;
+					remainder -= divisor;
+				}
+				return {uint128(estimate), remainder};
+			}
+			#pragma endregion Arithmetic
+
+			/*
+			SECTION: BITWISE OPERATORS
+			=============================================================
+			^ (XOR) DONE
+			| (OR) DONE
+			& (AND) DONE
+			~ (NOT) DONE
+			<< (shift left) DONE
+			>> (shift right) DONE
+			respective compound operators (^=, |=, &=, <<=, >>=) DONE
+			=============================================================
+			*/
+			#pragma region Bitwise
+
+			constexpr uint128& operator^= (uint128 const& rhs) noexcept {
+				B1 ^= rhs.B1;
+				B0 ^= rhs.B0;
+				return *this;
+			}
+			constexpr uint128 operator^ (uint128 const& rhs) const noexcept {
+				return uint128(B1 ^ rhs.B1, B0 ^ rhs.B0);
+			}
+
+			constexpr uint128& operator|= (uint128 const& rhs) noexcept {
+				B1 |= rhs.B1;
+				B0 |= rhs.B0;
+				return *this;
+			}
+			constexpr uint128 operator| (uint128 const& rhs) const noexcept {
+				return uint128(B1 | rhs.B1, B0 | rhs.B0);
+			}
+
+			constexpr uint128& operator&= (uint128 const& rhs) noexcept {
+				B1 &= rhs.B1;
+				B0 &= rhs.B0;
+				return *this;
+			}
+			constexpr uint128 operator& (uint128 const& rhs) const noexcept {
+				return uint128(B1 & rhs.B1, B0 & rhs.B0);
+			}
+
+			constexpr uint128 operator~ () const noexcept {
+				return uint128(~B1, ~B0);
+			}
+
+			constexpr uint128& operator<<= (unsigned int const& rhs) noexcept {
+				// Special case, because bitshifting by the bitsize of an integer is undefined (and inconsistent) behaviour
+				if (rhs == 0) return *this;
+
+				if (rhs >= 128) {
+					B0 = 0;
+					B1 = 0;
+				}
+				else if (rhs >= 64) {
+					B1 = B0 << (rhs-64);
+					B0 = 0;
+				} else {
+					B1 = (B1 << rhs) | (B0 >> (64-rhs));
+					B0 <<= rhs;
+				}
+				return *this;
+			}
+			constexpr uint128 operator<< (unsigned int const& rhs) const noexcept {
+				uint128 result(B1, B0);
+				return result <<= rhs;
+			}
+
+			constexpr uint128& operator>>= (unsigned int const& rhs) noexcept {
+				// Special case, because bitshifting by the bitsize of an integer is undefined (and inconsistent) behaviour
+				if (rhs == 0) return *this;
+
+				if (rhs >= 128) {
+					B0 = 0;
+					B1 = 0;
+				}
+				else if (rhs >= 64) {
+					B0 = B1 >> (rhs-64);
+					B1 = 0;
+				} else {
+					B0 = (B0 >> rhs) | (B1 << (64-rhs));
+					B1 >>= rhs;
+				}
+				return *this;
+			}
+			constexpr uint128 operator>> (unsigned int const& rhs) const noexcept {
+				uint128 result(B1, B0);
+				return result >>= rhs;
+			}
+			#pragma endregion Bitwise
+
+			/*
+			SECTION: RELATIONAL OPERATORS
+			=============================================================
+			== (equality) DONE
+			!= (not equality) DONE
+			> (greater-than) DONE
+			< (less-than) DONE
+			>= (greater-than-or-equal-to) DONE
+			<= (less-than-or-equal-to) DONE
+			<=> (three-way comparison) DONE
+			hash DONE
+			=============================================================
+			*/
+			#pragma region Relational
+
+			constexpr bool operator== (uint128 const& rhs) const noexcept {
+				return (B0 == rhs.B0 && B1 == rhs.B1);
+			}
+			constexpr bool operator!= (uint128 const& rhs) const noexcept {
+				return (B0 != rhs.B0 || B1 != rhs.B1);
+			}
+			// Without a sign, the words are simply compared from the most significant one
+			constexpr bool operator> (uint128 const& rhs) const noexcept {
+				return B1 != rhs.B1 ? B1 > rhs.B1 : B0 > rhs.B0;
+			}
+			constexpr bool operator< (uint128 const& rhs) const noexcept {
+				return B1 != rhs.B1 ? B1 < rhs.B1 : B0 < rhs.B0;
+			}
+			constexpr bool operator>= (uint128 const& rhs) const noexcept {
+				return B1 != rhs.B1 ? B1 > rhs.B1 : B0 >= rhs.B0;
+			}
+			constexpr bool operator<= (uint128 const& rhs) const noexcept {
+				return B1 != rhs.B1 ? B1 < rhs.B1 : B0 <= rhs.B0;
+			}
+			constexpr std::strong_ordering operator<=> (uint128 const& rhs) const noexcept {
+				if (B1 != rhs.B1) return B1 <=> rhs.B1;
+				return B0 <=> rhs.B0;
+			}
+
+			// Mixes both words with the wyhash mixing function (the same hash as an int128 with the same bits)
+			constexpr std::size_t hash() const noexcept {
+				return std::size_t(hashMix(hashMix(B0 ^ HASH_SECRET_1, B1 ^ HASH_SECRET_0) ^ HASH_SECRET_1, HASH_SECRET_0));
+			}
+			#pragma endregion Relational
+
+			/*
+			SECTION: LOGICAL OPERATORS
+			=============================================================
+			! (NOT) DONE
+			&& (AND) DONE
+			|| (OR) DONE
+			=============================================================
+			*/
+			#pragma region Logical
+			constexpr bool operator! () const noexcept {
+				return (B1 == 0 && B0 == 0);
+			}
+			constexpr bool operator&& (uint128 const& rhs) const noexcept {
+				return ((B1 != 0 || B0 != 0) && (rhs.B1 != 0 || rhs.B0 != 0));
+			}
+			constexpr bool operator|| (uint128 const& rhs) const noexcept {
+				return (B1 != 0 || B0 != 0 || rhs.B1 != 0 || rhs.B0 != 0);
+			}
+			#pragma endregion Logical
+
+			/*
+			SECTION: MATH
+			=============================================================
+			ilog2 DONE
+			pow DONE
+			isqrt DONE
+			gcd DONE
+			mulMod DONE
+			powMod DONE
+			=============================================================
+			*/
+			#pragma region Math
+			// Returns the amount of bits used by the value (floored binary log + 1), just like int_limited::ilog2()
+			constexpr int ilog2() const {
+				if (B1 == 0 && B0 == 0) throw std::domain_error("Logarithm of non-positive exception");
+				if (B1 != 0) return 128 - std::countl_zero(B1);
+				return 64 - std::countl_zero(B0);
+			}
+
+			// Fast exponentiation, the result wraps around (modulo 2^128) just like multiplication
+			constexpr uint128 pow(uint32_t exp) const noexcept {
+				uint128 result = 1;
+				uint128 base(B1, B0);
+				while (exp != 0) {
+					if (exp & 1) result *= base;
+					exp >>= 1;
+					if (exp != 0) base *= base;
+				}
+				return result;
+			}
+
+			// Returns the floored value of the square root
+			// The square root of the value converted to a double has a relative error of about 2^-52
+			// so a single Newton step lands on the result or one above it and the loop only confirms it
+			// During constant evaluation the seed is a power of two above the result instead
+			constexpr uint128 isqrt() const noexcept {
+				if (B1 == 0 && B0 < 2) return uint128(B1, B0);
+				uint128 root;
+				if (std::is_constant_evaluated()) {
+					root = uint128(1) << ((ilog2() + 1)/2);
+				} else {
+					double approximation = std::sqrt(std::ldexp(double(B1), 64) + double(B0));
+					root = approximation >= 18446744073709551615.0 ? uint128(UINT64_MAX) : uint128(uint64_t(approximation));
+				}
+				// A Newton step never goes below the floored root, after that it decreases until it reaches it
+				uint128 value(B1, B0);
+				root = (root + value / root) >> 1;
+				while (true) {
+					uint128 next = (root + value / root) >> 1;
+					if (next >= root) return root;
+					root = next;
+				}
+			}
+
+			// Binary GCD (Stein's algorithm), which only needs shifts and subtractions
+			// gcd(0, 0) is 0
+			static constexpr uint128 gcd(uint128 a, uint128 b) noexcept {
+				if (!a) return b;
+				if (!b) return a;
+				int shift = countTrailingZeroes(a | b);
+				a >>= countTrailingZeroes(a);
+				do {
+					b >>= countTrailingZeroes(b);
+					if (a > b) std::swap(a, b);
+					b -= a;
+				} while (!!b);
+				return a << shift;
+			}
+
+			// Returns (a*b) mod modulus without overflowing
+			// If the modulus fits into 64 bits, so does each reduced factor, and their product fits into 128 bits
+			// Otherwise the full 256 bit product is reduced with Knuth's algorithm D in base 2^64
+			// (the same estimate and correction as in divide128By64, one word of the quotient at a time)
+			static constexpr uint128 mulMod(uint128 const& a, uint128 const& b, uint128 const& modulus) {
+				if (modulus.B1 == 0) {
+					if (modulus.B0 == 0) throw std::domain_error("Divide by zero exception");
+					return ((a % modulus) * (b % modulus)) % modulus;
+				}
+				// Least significant word first, with an extra word for the normalization
+				uint64_t product[5] = {};
+				const uint64_t aWords[2] = {a.B0, a.B1};
+				const uint64_t bWords[2] = {b.B0, b.B1};
+				for (int i = 0; i < 2; i++) {
+					uint128 carry;
+					for (int j = 0; j < 2; j++) {
+						carry += uint128(aWords[i]) * uint128(bWords[j]) + uint128(product[i+j]);
+						product[i+j] = carry.B0;
+						carry = uint128(carry.B1);
+					}
+					product[i+2] = carry.B0;
+				}
+
+				// The highest bit of the divisor must be set for the estimates to be at most two too large
+				int shift = std::countl_zero(modulus.B1);
+				uint128 divisor = modulus << shift;
+				if (shift != 0) {
+					product[4] = product[3] >> (64 - shift);
+					for (int i = 3; i > 0; i--) product[i] = (product[i] << shift) | (product[i-1] >> (64 - shift));
+					product[0] <<= shift;
+				}
+
+				for (int j = 2; j >= 0; j--) {
+					// The top word is never larger than the top word of the divisor (it is part of the remainder)
+					uint64_t estimate, rem;
+					bool remOverflow = false;
+					if (product[j+2] == divisor.B1) {
+						estimate = UINT64_MAX;
+						rem = product[j+1] + divisor.B1;
+						remOverflow = rem < divisor.B1;
+					} else {
+						estimate = divide128By64(product[j+2], product[j+1], divisor.B1, rem);
+					}
+					while (!remOverflow && uint128(estimate) * uint128(divisor.B0) > uint128(rem, product[j])) {
+						estimate--;
+						rem += divisor.B1;
+						remOverflow = rem < divisor.B1;
+					}
+
+					// Subtract estimate*divisor from the top three words
+					uint128 lowProduct = uint128(estimate) * uint128(divisor.B0);
+					uint128 highProduct = uint128(estimate) * uint128(divisor.B1) + uint128(lowProduct.B1);
+					const uint64_t subtrahend[3] = {lowProduct.B0, highProduct.B0, highProduct.B1};
+					bool borrow = false;
+					for (int k = 0; k < 3; k++) {
+						uint64_t word = product[j+k];
+						product[j+k] = word - subtrahend[k] - borrow;
+						borrow = word < subtrahend[k] || (word == subtrahend[k] && borrow);
+					}
+					// The estimate was still one too large (rare), so the divisor is added back
+					if (borrow) {
+						const uint64_t addend[3] = {divisor.B0, divisor.B1, 0};
+						bool carry = false;
+						for (int k = 0; k < 3; k++) {
+							uint64_t sum = product[j+k] + addend[k] + carry;
+							carry = sum < product[j+k] || (sum == product[j+k] && carry);
+							product[j+k] = sum;
+						}
+					}
+				}
+				return uint128(product[1], product[0]) >> shift;
+			}
+
+			// Returns (value^exp) mod modulus, calculated by fast exponentiation with mulMod
+			constexpr uint128 powMod(uint128 exp, uint128 const& modulus) const {
+				if (!modulus) throw std::domain_error("Divide by zero exception");
+				uint128 result = uint128(1) % modulus;
+				uint128 base = uint128(B1, B0) % modulus;
+				while (!!exp) {
+					if (exp.B0 & 1) result = mulMod(result, base, modulus);
+					exp >>= 1;
+					if (!!exp) base = mulMod(base, base, modulus);
+				}
+				return result;
+			}
+			#pragma endregion Math
+	};
+
+	// Two words and nothing else, so it is passed in registers and can be copied with memcpy
+	static_assert(std::is_trivially_copyable_v<uint128> && sizeof(uint128) == 16);
+}
+
+// Allows uint128 to be used in unordered containers
+template <>
+struct std::hash<largeNumberLibrary::uint128> {
+	std::size_t operator() (largeNumberLibrary::uint128 const& value) const noexcept {
+		return value.hash();
+	}
+};